@@ -0,0 +1,40 @@
+#ifndef S21_CONTAINERS_S21_BENCH_HPP
+#define S21_CONTAINERS_S21_BENCH_HPP
+
+#include <atomic>  // NOLINT(build/c++11)
+#include <chrono>  // NOLINT(build/c++11)
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace s21_bench {
+
+// Счетчик вызовов глобального operator new, определен в s21_containers_bench.cpp
+extern std::atomic<size_t> allocations;
+
+// Время выполнения func в миллисекундах
+template <class Func>
+double elapsed_ms(Func &&func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// Печатает строку отчета: имя замера, число операций, общее время и время на операцию
+inline void report(const std::string &name, size_t operations, double ms) {
+    std::cout << "[  BENCH   ] " << std::left << std::setw(40) << name << " n=" << std::setw(11) << operations
+              << std::right << std::fixed << std::setprecision(2) << std::setw(10) << ms << " ms "
+              << std::setw(8) << (operations ? ms * 1e6 / operations : 0.0) << " ns/op" << std::endl;
+}
+
+// Не дает компилятору выбросить вычисление value
+template <class T>
+inline void do_not_optimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_CONTAINERS_S21_BENCH_HPP
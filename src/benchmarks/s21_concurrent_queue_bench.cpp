@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>  // NOLINT(build/c++11)
+#include <mutex>   // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "../classes/s21_concurrent_queue.hpp"
+#include "../classes/s21_queue.hpp"
+#include "s21_bench.hpp"
+
+// Поток элементов от N производителей к N потребителям, N = 1-32. Сравнение с s21::queue под
+// мьютексом; на машине с одним ядром видна стоимость синхронизации и ожидания, а не масштабирование
+namespace {
+
+const size_t queue_bench_items = 2000000;
+const size_t queue_bench_batch = 32;
+
+// Запускает threads производителей и столько же потребителей; push(value) и pop(sum) возвращают,
+// сколько элементов удалось передать, при неудаче поток уступает процессор
+template <class Push, class Pop>
+double queue_bench_run(size_t threads, Push push, Pop pop, int64_t &total) {
+    std::atomic<size_t> consumed(0);
+    std::atomic<int64_t> sum(0);
+    size_t per_thread = queue_bench_items / threads;
+    size_t n = per_thread * threads;
+    double ms = s21_bench::elapsed_ms([&] {
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&push, per_thread, t] {
+                for (size_t i = 0; i < per_thread;) {
+                    size_t pushed = push(static_cast<int>(t * per_thread + i), per_thread - i);
+                    if (!pushed) std::this_thread::yield();
+                    i += pushed;
+                }
+            });
+            workers.emplace_back([&pop, &consumed, &sum, n] {
+                int64_t local = 0;
+                while (consumed.load(std::memory_order_relaxed) < n) {
+                    size_t popped = pop(local);
+                    if (!popped) std::this_thread::yield();
+                    consumed.fetch_add(popped, std::memory_order_relaxed);
+                }
+                sum.fetch_add(local);
+            });
+        }
+        for (auto &worker : workers) worker.join();
+    });
+    total = sum;
+    return ms;
+}
+
+}  // namespace
+
+TEST(s21_concurrent_queue_bench, producers_consumers) {
+    std::cout << "[  BENCH   ] hardware threads " << std::thread::hardware_concurrency() << std::endl;
+    for (size_t threads : {1, 2, 4, 8, 16, 32}) {
+        size_t n = queue_bench_items / threads * threads;
+        int64_t expected = static_cast<int64_t>(n) * static_cast<int64_t>(n - 1) / 2;
+        std::string suffix = " x" + std::to_string(threads);
+        int64_t total = 0;
+
+        s21::concurrent_queue<int> concurrent(4096);
+        double concurrent_ms = queue_bench_run(
+            threads, [&](int value, size_t) -> size_t { return concurrent.try_push(value); },
+            [&](int64_t &sum) -> size_t {
+                int value;
+                if (!concurrent.try_pop(value)) return 0;
+                sum += value;
+                return 1;
+            },
+            total);
+        ASSERT_EQ(total, expected);
+
+        double batch_ms = queue_bench_run(
+            threads,
+            [&](int value, size_t left) {
+                std::array<int, queue_bench_batch> batch;
+                size_t count = left < batch.size() ? left : batch.size();
+                for (size_t k = 0; k < count; ++k) batch[k] = value + static_cast<int>(k);
+                return concurrent.push_n(batch.begin(), count);
+            },
+            [&](int64_t &sum) {
+                std::array<int, queue_bench_batch> batch;
+                size_t count = concurrent.pop_n(batch.begin(), batch.size());
+                for (size_t k = 0; k < count; ++k) sum += batch[k];
+                return count;
+            },
+            total);
+        ASSERT_EQ(total, expected);
+
+        s21::queue<int> locked;
+        std::mutex mutex;
+        double locked_ms = queue_bench_run(
+            threads,
+            [&](int value, size_t) -> size_t {
+                std::lock_guard<std::mutex> lock(mutex);
+                locked.push(value);
+                return 1;
+            },
+            [&](int64_t &sum) -> size_t {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (locked.empty()) return 0;
+                sum += locked.front();
+                locked.pop();
+                return 1;
+            },
+            total);
+        ASSERT_EQ(total, expected);
+
+        s21_bench::report("s21::concurrent_queue try_push/pop" + suffix, n, concurrent_ms);
+        s21_bench::report("s21::concurrent_queue push_n/pop_n" + suffix, n, batch_ms);
+        s21_bench::report("mutex + s21::queue push/pop" + suffix, n, locked_ms);
+    }
+}
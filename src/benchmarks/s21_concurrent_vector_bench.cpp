@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <mutex>   // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "../classes/s21_concurrent_vector.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+// Одновременная запись 1-32 потоками. Сравнение с s21::vector под мьютексом; на машине с одним ядром
+// видна стоимость синхронизации, а не масштабирование
+namespace {
+
+const size_t concurrent_bench_size = 4000000;
+
+template <class Push>
+double concurrent_bench_run(size_t threads, Push push) {
+    return s21_bench::elapsed_ms([&] {
+        std::vector<std::thread> workers;
+        size_t per_thread = concurrent_bench_size / threads;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&push, per_thread, t] {
+                for (size_t i = 0; i < per_thread; ++i) push(static_cast<int>(t * per_thread + i));
+            });
+        }
+        for (auto &worker : workers) worker.join();
+    });
+}
+
+}  // namespace
+
+TEST(s21_concurrent_vector_bench, push_back) {
+    std::cout << "[  BENCH   ] hardware threads " << std::thread::hardware_concurrency() << std::endl;
+    for (size_t threads : {1, 2, 4, 8, 16, 32}) {
+        size_t n = concurrent_bench_size / threads * threads;
+        std::string suffix = " x" + std::to_string(threads);
+
+        s21::concurrent_vector<int> concurrent;
+        double concurrent_ms = concurrent_bench_run(threads, [&](int value) { concurrent.push_back(value); });
+        ASSERT_EQ(concurrent.size(), n);
+
+        s21::vector<int> locked;
+        std::mutex mutex;
+        double locked_ms = concurrent_bench_run(threads, [&](int value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked.push_back(value);
+        });
+        ASSERT_EQ(locked.size(), n);
+
+        s21_bench::report("s21::concurrent_vector push_back" + suffix, n, concurrent_ms);
+        s21_bench::report("mutex + s21::vector push_back" + suffix, n, locked_ms);
+    }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "../classes/s21_dynamic_bitset.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+TEST(s21_dynamic_bitset_bench, flags) {
+    const size_t n = size_t(1) << 28;
+    s21::dynamic_bitset bits(n);
+    s21::vector<bool> flags(n);
+    std::cout << "[  BENCH   ] memory: dynamic_bitset " << bits.num_words() * sizeof(uint64_t) / (1 << 20)
+              << " MB, s21::vector<bool> " << n * sizeof(bool) / (1 << 20) << " MB" << std::endl;
+
+    uint64_t state = 88172645463325252ull;
+    double set_ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < n / 64; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            bits.set(state % n);
+        }
+    });
+    s21_bench::report("dynamic_bitset random set", n / 64, set_ms);
+    state = 88172645463325252ull;
+    for (size_t i = 0; i < n / 64; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        flags[state % n] = true;
+    }
+
+    size_t bits_count = 0;
+    double count_ms = s21_bench::elapsed_ms([&] { bits_count = bits.count(); });
+    s21_bench::report("dynamic_bitset::count", n, count_ms);
+    size_t flags_count = 0;
+    double flags_count_ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < n; ++i) flags_count += flags[i];
+    });
+    s21_bench::report("s21::vector<bool> count loop", n, flags_count_ms);
+    ASSERT_EQ(bits_count, flags_count);
+
+    size_t visited = 0;
+    double iterate_ms = s21_bench::elapsed_ms([&] {
+        for (size_t pos = bits.find_first(); pos != s21::dynamic_bitset::npos; pos = bits.find_next(pos)) {
+            ++visited;
+        }
+    });
+    s21_bench::report("dynamic_bitset find_first/find_next", visited, iterate_ms);
+    ASSERT_EQ(visited, bits_count);
+
+    s21::dynamic_bitset other(bits);
+    other.flip();
+    double bulk_ms = s21_bench::elapsed_ms([&] {
+        bits |= other;
+        bits &= other;
+        bits ^= other;
+        bits.and_not(other);
+    });
+    s21_bench::report("dynamic_bitset or/and/xor/andnot", 4 * bits.num_words(), bulk_ms);
+    std::cout << "[  BENCH   ]   bulk throughput " << 4 * 3 * n / 8 / 1e6 / bulk_ms << " GB/s" << std::endl;
+}
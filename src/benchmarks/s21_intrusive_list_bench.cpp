@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../classes/s21_intrusive_list.hpp"
+#include "../classes/s21_list.hpp"
+#include "s21_bench.hpp"
+
+// Объекты соединений уже лежат в пуле: s21::list копирует каждый в новый узел, intrusive_list
+// связывает сами объекты через встроенное звено
+namespace {
+
+const size_t intrusive_bench_objects = 1000000;
+
+struct bench_connection {
+    int64_t id;
+    int64_t payload[3];
+    s21::intrusive_list_hook hook;
+};
+
+using bench_connections = s21::intrusive_list<bench_connection, &bench_connection::hook>;
+
+void intrusive_bench_allocations(size_t allocations, size_t operations) {
+    std::cout << "[  BENCH   ]   allocations per object: " << static_cast<double>(allocations) / operations
+              << std::endl;
+}
+
+}  // namespace
+
+TEST(s21_intrusive_list_bench, link_unlink) {
+    const size_t rounds = 5;
+    std::vector<bench_connection> pool(intrusive_bench_objects);
+    for (size_t i = 0; i < pool.size(); ++i) pool[i].id = static_cast<int64_t>(i);
+
+    s21::list<bench_connection> copies;
+    size_t allocations = s21_bench::allocations;
+    double list_ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            for (auto &connection : pool) copies.push_back(connection);
+            while (!copies.empty()) copies.pop_front();
+        }
+    });
+    s21_bench::report("s21::list<connection> push/pop", 2 * rounds * pool.size(), list_ms);
+    intrusive_bench_allocations(s21_bench::allocations - allocations, rounds * pool.size());
+
+    bench_connections linked;
+    allocations = s21_bench::allocations;
+    double intrusive_ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            for (auto &connection : pool) linked.push_back(connection);
+            while (!linked.empty()) linked.pop_front();
+        }
+    });
+    allocations = s21_bench::allocations - allocations;
+    s21_bench::report("s21::intrusive_list<connection> push/pop", 2 * rounds * pool.size(), intrusive_ms);
+    intrusive_bench_allocations(allocations, rounds * pool.size());
+    ASSERT_EQ(allocations, 0);
+}
+
+TEST(s21_intrusive_list_bench, unlink_anywhere) {
+    // Отмена таймеров в случайном порядке: объект исключается по своему звену без поиска
+    std::vector<bench_connection> pool(intrusive_bench_objects);
+    std::vector<size_t> order(pool.size());
+    for (size_t i = 0; i < pool.size(); ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+    bench_connections linked;
+    for (auto &connection : pool) linked.push_back(connection);
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t index : order) linked.erase(pool[index]);
+    });
+    s21_bench::report("s21::intrusive_list<connection> erase(obj)", order.size(), ms);
+    ASSERT_TRUE(linked.empty());
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+
+#include "../classes/s21_list.hpp"
+#include "s21_bench.hpp"
+
+// Очередь на миллион узлов: каждый раунд заполняет список и опустошает его с головы
+namespace {
+
+const size_t list_bench_nodes = 1000000;
+
+void list_bench_push_pop(const std::string &name, s21::list<int64_t> &list, size_t rounds) {
+    size_t allocations = s21_bench::allocations;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            for (size_t i = 0; i < list_bench_nodes; ++i) list.push_back(static_cast<int64_t>(i));
+            while (!list.empty()) list.pop_front();
+        }
+    });
+    allocations = s21_bench::allocations - allocations;
+    s21_bench::report(name, 2 * rounds * list_bench_nodes, ms);
+    std::cout << "[  BENCH   ]   allocations per node: "
+              << static_cast<double>(allocations) / (rounds * list_bench_nodes) << std::endl;
+}
+
+int64_t list_bench_sum(const s21::list<int64_t> &list) {
+    int64_t sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    return sum;
+}
+
+}  // namespace
+
+TEST(s21_list_bench, push_pop) {
+    const size_t rounds = 5;
+    s21::list<int64_t> heap;
+    list_bench_push_pop("s21::list<int64_t> heap push/pop", heap, rounds);
+    s21::list_node_pool<int64_t> pool;
+    s21::list<int64_t> pooled(pool);
+    list_bench_push_pop("s21::list<int64_t> pool push/pop", pooled, rounds);
+}
+
+TEST(s21_list_bench, traversal) {
+    // Два списка растут попеременно, как очереди одного обработчика: из кучи их узлы чередуются,
+    // из отдельных пулов каждый список лежит своими блоками
+    s21::list<int64_t> heap_a, heap_b;
+    s21::list_node_pool<int64_t> pool_a, pool_b;
+    s21::list<int64_t> pooled_a(pool_a), pooled_b(pool_b);
+    for (size_t i = 0; i < list_bench_nodes; ++i) {
+        heap_a.push_back(static_cast<int64_t>(i));
+        heap_b.push_back(static_cast<int64_t>(i));
+        pooled_a.push_back(static_cast<int64_t>(i));
+        pooled_b.push_back(static_cast<int64_t>(i));
+    }
+    int64_t heap_sum = 0, pooled_sum = 0;
+    double heap_ms = s21_bench::elapsed_ms([&] {
+        for (int round = 0; round < 10; ++round) heap_sum += list_bench_sum(heap_a);
+    });
+    double pooled_ms = s21_bench::elapsed_ms([&] {
+        for (int round = 0; round < 10; ++round) pooled_sum += list_bench_sum(pooled_a);
+    });
+    s21_bench::report("s21::list<int64_t> heap traversal", 10 * list_bench_nodes, heap_ms);
+    s21_bench::report("s21::list<int64_t> pool traversal", 10 * list_bench_nodes, pooled_ms);
+    ASSERT_EQ(heap_sum, pooled_sum);
+}
+
+TEST(s21_list_bench, sort) {
+    // Сортировка меняет только связи узлов; для сравнения std::list::sort на тех же данных
+    for (size_t n : {100000ul, 1000000ul}) {
+        std::mt19937_64 gen(42);
+        s21::list<int64_t> list;
+        std::list<int64_t> std_list;
+        for (size_t i = 0; i < n; ++i) {
+            int64_t value = static_cast<int64_t>(gen() % n);
+            list.push_back(value);
+            std_list.push_back(value);
+        }
+        double s21_ms = s21_bench::elapsed_ms([&] { list.sort(); });
+        double std_ms = s21_bench::elapsed_ms([&] { std_list.sort(); });
+        s21_bench::report("s21::list<int64_t>::sort", n, s21_ms);
+        s21_bench::report("std::list<int64_t>::sort", n, std_ms);
+        ASSERT_EQ(list.front(), std_list.front());
+        ASSERT_EQ(list.back(), std_list.back());
+    }
+}
+
+TEST(s21_list_bench, splice_batches) {
+    // Пакет из миллиона узлов переносится между списками туда и обратно без выделения памяти
+    s21::list<int64_t> source, target;
+    for (size_t i = 0; i < list_bench_nodes; ++i) source.push_back(static_cast<int64_t>(i));
+    const size_t rounds = 1000;
+    size_t allocations = s21_bench::allocations;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            target.splice(target.end(), source);
+            source.splice(source.begin(), target);
+        }
+    });
+    allocations = s21_bench::allocations - allocations;
+    s21_bench::report("s21::list<int64_t>::splice 1M nodes", 2 * rounds, ms);
+    ASSERT_EQ(allocations, 0u);
+    ASSERT_EQ(source.size(), list_bench_nodes);
+    double reverse_ms = s21_bench::elapsed_ms([&] { source.reverse(); });
+    s21_bench::report("s21::list<int64_t>::reverse", list_bench_nodes, reverse_ms);
+    ASSERT_EQ(source.front(), static_cast<int64_t>(list_bench_nodes - 1));
+}
+
+TEST(s21_list_bench, unique) {
+    // Отсортированный список из миллиона узлов, каждое значение повторяется 4 раза
+    s21::list<int64_t> list;
+    for (size_t i = 0; i < list_bench_nodes; ++i) list.push_back(static_cast<int64_t>(i / 4));
+    size_t removed = 0;
+    double ms = s21_bench::elapsed_ms([&] { removed = list.unique(); });
+    s21_bench::report("s21::list<int64_t>::unique", list_bench_nodes, ms);
+    ASSERT_EQ(removed, list_bench_nodes / 4 * 3);
+    ASSERT_EQ(list.size(), list_bench_nodes / 4);
+}
+
+TEST(s21_list_bench, string_traversal) {
+    // Строки длиннее буфера малых строк: копия при разыменовании выделяет память. Для сравнения
+    // проход, копирующий каждый элемент, как делал прежний operator* по значению
+    s21::list<std::string> list;
+    for (size_t i = 0; i < list_bench_nodes; ++i) {
+        list.push_back("connection-" + std::to_string(i) + "-payload-string");
+    }
+    const int rounds = 5;
+    size_t by_reference = 0, by_value = 0;
+    size_t allocations = s21_bench::allocations;
+    double reference_ms = s21_bench::elapsed_ms([&] {
+        for (int round = 0; round < rounds; ++round) {
+            for (auto it = list.begin(); it != list.end(); ++it) by_reference += it->size();
+        }
+    });
+    size_t reference_allocations = s21_bench::allocations - allocations;
+    allocations = s21_bench::allocations;
+    double value_ms = s21_bench::elapsed_ms([&] {
+        for (int round = 0; round < rounds; ++round) {
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                std::string value = *it;
+                by_value += value.size();
+            }
+        }
+    });
+    size_t value_allocations = s21_bench::allocations - allocations;
+    s21_bench::report("s21::list<std::string> by reference", rounds * list_bench_nodes, reference_ms);
+    std::cout << "[  BENCH   ]   allocations per element: "
+              << static_cast<double>(reference_allocations) / (rounds * list_bench_nodes) << std::endl;
+    s21_bench::report("s21::list<std::string> copy per element", rounds * list_bench_nodes, value_ms);
+    std::cout << "[  BENCH   ]   allocations per element: "
+              << static_cast<double>(value_allocations) / (rounds * list_bench_nodes) << std::endl;
+    ASSERT_EQ(reference_allocations, 0u);
+    ASSERT_EQ(by_reference, by_value);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+#include "../classes/s21_mmap_vector.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+TEST(s21_mmap_vector_bench, open_existing_file) {
+    // Открытие отображения не зависит от размера файла, загрузка в s21::vector читает его целиком
+    const size_t n = 25000000;
+    std::string path = "/tmp/s21_mmap_vector_bench_" + std::to_string(::getpid());
+    std::remove(path.c_str());
+    double write_ms = s21_bench::elapsed_ms([&] {
+        s21::mmap_vector<int> vector(path);
+        vector.resize(n);
+        std::iota(vector.begin(), vector.end(), 0);
+    });
+    s21_bench::report("s21::mmap_vector<int> write", n, write_ms);
+
+    long mmap_sum = 0;
+    double open_ms = 0;
+    double mmap_ms = s21_bench::elapsed_ms([&] {
+        open_ms = s21_bench::elapsed_ms([&] {
+            s21::mmap_vector<int> vector(path, s21::mmap_vector<int>::mode::read_only);
+            s21_bench::do_not_optimize(vector.data());
+        });
+        s21::mmap_vector<int> vector(path, s21::mmap_vector<int>::mode::read_only);
+        mmap_sum = std::accumulate(vector.begin(), vector.end(), 0l);
+    });
+
+    long load_sum = 0;
+    double load_ms = 0;
+    double vector_ms = s21_bench::elapsed_ms([&] {
+        s21::vector<int> vector;
+        load_ms = s21_bench::elapsed_ms([&] {
+            std::ifstream file(path, std::ios::binary);
+            int value;
+            while (file.read(reinterpret_cast<char *>(&value), sizeof(value))) vector.push_back(value);
+        });
+        load_sum = std::accumulate(vector.begin(), vector.end(), 0l);
+    });
+    std::remove(path.c_str());
+
+    s21_bench::report("s21::mmap_vector<int> open", n, open_ms);
+    s21_bench::report("s21::mmap_vector<int> open + scan", n, mmap_ms);
+    s21_bench::report("s21::vector<int> load", n, load_ms);
+    s21_bench::report("s21::vector<int> load + scan", n, vector_ms);
+    ASSERT_EQ(mmap_sum, load_sum);
+}
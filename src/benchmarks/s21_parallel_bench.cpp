@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+
+#include "../classes/s21_parallel.hpp"
+#include "s21_bench.hpp"
+
+// Масштабирование по числу потоков. Цель - почти линейный рост до 16 потоков на 10^8 элементов;
+// здесь 10^7, чтобы замер укладывался в общий прогон. Ускорение ограничено числом ядер машины
+namespace {
+
+const size_t parallel_bench_size = 10000000;
+
+s21::vector<double> parallel_bench_vector() {
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    s21::vector<double> vector;
+    vector.reserve(parallel_bench_size);
+    for (size_t i = 0; i < parallel_bench_size; ++i) vector.push_back(dist(gen));
+    return vector;
+}
+
+void parallel_bench_speedup(const std::string &name, double serial_ms, double ms) {
+    std::cout << "[  BENCH   ]   " << name << " speedup " << std::setprecision(2) << serial_ms / ms << "x"
+              << std::endl;
+}
+
+}  // namespace
+
+TEST(s21_parallel_bench, scaling) {
+    const s21::vector<double> source = parallel_bench_vector();
+    s21::vector<double> vector(source);
+    s21::vector<double> out(parallel_bench_size);
+    const size_t n = parallel_bench_size;
+    std::cout << "[  BENCH   ] hardware threads " << std::thread::hardware_concurrency() << std::endl;
+
+    vector = source;
+    double sort_serial = s21_bench::elapsed_ms([&] { std::sort(vector.begin(), vector.end()); });
+    double transform_serial = s21_bench::elapsed_ms([&] {
+        std::transform(vector.begin(), vector.end(), out.begin(),
+                       [](double x) { return std::sqrt(x * x + 1); });
+    });
+    double serial_sum = 0;
+    double reduce_serial =
+        s21_bench::elapsed_ms([&] { serial_sum = std::accumulate(vector.begin(), vector.end(), 0.0); });
+    s21_bench::do_not_optimize(serial_sum);
+    s21_bench::report("std::sort<double>", n, sort_serial);
+    s21_bench::report("std::transform<double>", n, transform_serial);
+    s21_bench::report("std::accumulate<double>", n, reduce_serial);
+
+    double first_sum = 0;
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        s21::thread_pool pool(threads);
+        std::string suffix = " threads=" + std::to_string(threads);
+
+        vector = source;
+        double sort_ms = s21_bench::elapsed_ms([&] { s21::parallel_sort(pool, vector); });
+        ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end()));
+        double for_each_ms = s21_bench::elapsed_ms(
+            [&] { s21::parallel_for_each(pool, vector, [](double &x) { x = x * 0.5 + 1; }); });
+        double transform_ms = s21_bench::elapsed_ms([&] {
+            s21::parallel_transform(pool, vector, out, [](double x) { return std::sqrt(x * x + 1); });
+        });
+        double sum = 0;
+        vector = source;
+        double reduce_ms = s21_bench::elapsed_ms([&] { sum = s21::parallel_reduce(pool, vector, 0.0); });
+        if (threads == 1) first_sum = sum;
+        ASSERT_EQ(sum, first_sum);
+
+        s21_bench::report("s21::parallel_sort<double>" + suffix, n, sort_ms);
+        parallel_bench_speedup("sort", sort_serial, sort_ms);
+        s21_bench::report("s21::parallel_for_each<double>" + suffix, n, for_each_ms);
+        s21_bench::report("s21::parallel_transform<double>" + suffix, n, transform_ms);
+        parallel_bench_speedup("transform", transform_serial, transform_ms);
+        s21_bench::report("s21::parallel_reduce<double>" + suffix, n, reduce_ms);
+        parallel_bench_speedup("reduce", reduce_serial, reduce_ms);
+    }
+}
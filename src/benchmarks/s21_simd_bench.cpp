@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../classes/s21_simd.hpp"
+#include "s21_bench.hpp"
+
+const char *simd_isa_name(s21::simd::isa isa) {
+    return (isa == s21::simd::isa::avx2) ? "avx2" : (isa == s21::simd::isa::sse2) ? "sse2" : "scalar";
+}
+
+template <typename T, class Func>
+void simd_throughput_bench(const std::string &name, size_t n, size_t rounds, Func &&func) {
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) s21_bench::do_not_optimize(func());
+    });
+    s21_bench::report(name, n * rounds, ms);
+    std::cout << "[  BENCH   ]   throughput " << (n * rounds * sizeof(T) / 1e6) / ms << " GB/s" << std::endl;
+}
+
+template <typename T>
+void simd_kernels_bench(const std::string &type) {
+    const size_t n = 4000000;
+    const size_t rounds = 20;
+    s21::vector<T> vector(n);
+    for (size_t i = 0; i < n; ++i) vector[i] = static_cast<T>(i % 1000);
+    s21::vector<T> copy(vector);
+    T *first = vector.data();
+    T *last = first + n;
+
+    simd_throughput_bench<T>("plain loop sum<" + type + ">", n, rounds, [&] {
+        s21::simd::sum_type<T> result = 0;
+        for (T *it = first; it != last; ++it) result += *it;
+        return result;
+    });
+    simd_throughput_bench<T>("plain loop find<" + type + ">", n, rounds, [&] {
+        T *it = first;
+        while (it != last && *it != T(-1)) ++it;
+        return it;
+    });
+    for (auto isa : {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2}) {
+        if (isa > s21::simd::supported_isa()) continue;
+        s21::simd::force_isa(isa);
+        std::string suffix = "<" + type + "> " + simd_isa_name(isa);
+        simd_throughput_bench<T>("find" + suffix, n, rounds, [&] { return s21::simd::find(vector, T(-1)); });
+        simd_throughput_bench<T>("count" + suffix, n, rounds, [&] { return s21::simd::count(vector, T(7)); });
+        simd_throughput_bench<T>("min" + suffix, n, rounds, [&] { return s21::simd::min(vector); });
+        simd_throughput_bench<T>("max" + suffix, n, rounds, [&] { return s21::simd::max(vector); });
+        simd_throughput_bench<T>("sum" + suffix, n, rounds, [&] { return s21::simd::sum(vector); });
+        simd_throughput_bench<T>("equal" + suffix, n, rounds, [&] { return s21::simd::equal(vector, copy); });
+    }
+    s21::simd::force_isa(s21::simd::supported_isa());
+}
+
+TEST(s21_simd_bench, int32_kernels) { simd_kernels_bench<int32_t>("int32_t"); }
+
+TEST(s21_simd_bench, float_kernels) { simd_kernels_bench<float>("float"); }
+
+TEST(s21_simd_bench, double_kernels) { simd_kernels_bench<double>("double"); }
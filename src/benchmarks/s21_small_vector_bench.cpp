@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../classes/s21_small_vector.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+template <class Vector>
+void small_vector_fill_bench(const std::string &name, size_t elements, size_t rounds) {
+    size_t allocations = s21_bench::allocations;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t round = 0; round < rounds; ++round) {
+            Vector vector;
+            for (size_t i = 0; i < elements; ++i) vector.push_back(static_cast<int>(i));
+            s21_bench::do_not_optimize(vector.data());
+        }
+    });
+    allocations = s21_bench::allocations - allocations;
+    s21_bench::report(name + " size=" + std::to_string(elements), rounds, ms);
+    std::cout << "[  BENCH   ]   allocations per vector: " << static_cast<double>(allocations) / rounds
+              << std::endl;
+}
+
+TEST(s21_small_vector_bench, fill_sizes) {
+    const size_t rounds = 200000;
+    for (size_t elements : {0, 1, 2, 4, 8, 16, 32, 64}) {
+        small_vector_fill_bench<s21::vector<int>>("s21::vector<int>", elements, rounds);
+        small_vector_fill_bench<s21::small_vector<int, 8>>("s21::small_vector<int, 8>", elements, rounds);
+    }
+}
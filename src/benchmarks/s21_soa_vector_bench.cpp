@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "../classes/s21_soa_vector.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+namespace {
+
+// Широкая запись в 64 байта: при проходе по price из каждой кэш-линии полезны 8 байт
+struct soa_bench_record {
+    int64_t id;
+    double price;
+    double quantity;
+    double bid;
+    double ask;
+    int64_t timestamp;
+    int64_t venue;
+    int64_t flags;
+};
+
+}  // namespace
+
+TEST(s21_soa_vector_bench, column_scan) {
+    // Цель - 10^8 строк; здесь 10^7, чтобы AoS и SoA копии вместе уместились в памяти
+    const size_t n = 10000000;
+    s21::vector<soa_bench_record> aos;
+    s21::soa_vector<int64_t, double, double, double, double, int64_t, int64_t, int64_t> soa;
+    aos.reserve(n);
+    soa.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        soa_bench_record record{static_cast<int64_t>(i), i * 0.25, i % 100 * 1.0, 0, 0, 0, 0, 0};
+        aos.push_back(record);
+        soa.push_back(record.id, record.price, record.quantity, record.bid, record.ask, record.timestamp,
+                      record.venue, record.flags);
+    }
+
+    double aos_sum = 0;
+    double aos_ms = s21_bench::elapsed_ms([&] {
+        for (soa_bench_record &record : aos) aos_sum += record.price;
+    });
+    double soa_sum = 0;
+    double soa_ms = s21_bench::elapsed_ms([&] {
+        for (double *p = soa.begin<1>(), *end = soa.end<1>(); p != end; ++p) soa_sum += *p;
+    });
+    s21_bench::report("AoS s21::vector<record> sum(price)", n, aos_ms);
+    s21_bench::report("SoA s21::soa_vector sum(price)", n, soa_ms);
+    std::cout << "[  BENCH   ]   speedup " << aos_ms / soa_ms << "x" << std::endl;
+    ASSERT_EQ(aos_sum, soa_sum);
+
+    double aos_value = 0;
+    double aos2_ms = s21_bench::elapsed_ms([&] {
+        for (soa_bench_record &record : aos) aos_value += record.price * record.quantity;
+    });
+    double soa_value = 0;
+    double soa2_ms = s21_bench::elapsed_ms([&] {
+        double *price = soa.data<1>();
+        double *quantity = soa.data<2>();
+        for (size_t i = 0; i < n; ++i) soa_value += price[i] * quantity[i];
+    });
+    s21_bench::report("AoS s21::vector<record> sum(price*qty)", n, aos2_ms);
+    s21_bench::report("SoA s21::soa_vector sum(price*qty)", n, soa2_ms);
+    std::cout << "[  BENCH   ]   speedup " << aos2_ms / soa2_ms << "x" << std::endl;
+    ASSERT_EQ(aos_value, soa_value);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../classes/s21_list.hpp"
+#include "../classes/s21_unrolled_list.hpp"
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+// Проход по 10^7 элементам int и накладные расходы памяти на элемент
+namespace {
+
+const size_t unrolled_bench_size = 10000000;
+
+template <class Container>
+void unrolled_bench_traversal(const std::string &name, Container &container, size_t bytes) {
+    int64_t sum = 0;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (int round = 0; round < 5; ++round) {
+            for (auto it = container.begin(); it != container.end(); ++it) sum += *it;
+        }
+    });
+    s21_bench::do_not_optimize(sum);
+    s21_bench::report(name, 5 * unrolled_bench_size, ms);
+    double payload = static_cast<double>(unrolled_bench_size * sizeof(int));
+    std::cout << "[  BENCH   ]   memory overhead " << (bytes - payload) / payload * 100 << "%" << std::endl;
+}
+
+}  // namespace
+
+TEST(s21_unrolled_list_bench, traversal) {
+    s21::vector<int> vector;
+    for (size_t i = 0; i < unrolled_bench_size; ++i) vector.push_back(static_cast<int>(i));
+    unrolled_bench_traversal("s21::vector<int> traversal", vector, vector.capacity() * sizeof(int));
+
+    using unrolled_type = s21::unrolled_list<int>;
+    size_t allocations = s21_bench::allocations;
+    unrolled_type unrolled;
+    for (size_t i = 0; i < unrolled_bench_size; ++i) unrolled.push_back(static_cast<int>(i));
+    size_t blocks = s21_bench::allocations - allocations;
+    unrolled_bench_traversal("s21::unrolled_list<int> traversal", unrolled, blocks * 512);
+
+    // Вставки в середину: каждый полный блок делится пополам, и блоки заполнены на 50-100%
+    unrolled_type inserted;
+    allocations = s21_bench::allocations;
+    inserted.push_back(0);
+    for (size_t i = 1; i < unrolled_bench_size; ++i) {
+        auto pos = inserted.end();
+        for (size_t step = 0; step < unrolled_type::block_capacity / 2 && pos != inserted.begin(); ++step) {
+            --pos;
+        }
+        inserted.insert(pos, static_cast<int>(i));
+    }
+    blocks = s21_bench::allocations - allocations;
+    unrolled_bench_traversal("s21::unrolled_list<int> middle inserts", inserted, blocks * 512);
+
+    s21::list<int> list;
+    for (size_t i = 0; i < unrolled_bench_size; ++i) list.push_back(static_cast<int>(i));
+    unrolled_bench_traversal("s21::list<int> traversal", list,
+                             unrolled_bench_size * sizeof(s21::list_item<int>));
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../classes/s21_vector.hpp"
+#include "s21_bench.hpp"
+
+TEST(s21_vector_bench, push_back) {
+    for (size_t n : {100000ul, 1000000ul, 10000000ul}) {
+        double s21_ms = s21_bench::elapsed_ms([n] {
+            s21::vector<int> vector;
+            for (size_t i = 0; i < n; ++i) vector.push_back(static_cast<int>(i));
+            s21_bench::do_not_optimize(vector.data());
+        });
+        double std_ms = s21_bench::elapsed_ms([n] {
+            std::vector<int> vector;
+            for (size_t i = 0; i < n; ++i) vector.push_back(static_cast<int>(i));
+            s21_bench::do_not_optimize(vector.data());
+        });
+        s21_bench::report("s21::vector<int>::push_back", n, s21_ms);
+        s21_bench::report("std::vector<int>::push_back", n, std_ms);
+    }
+}
+
+TEST(s21_vector_bench, push_back_linear_cost) {
+    // Суммарное число перемещений при геометрическом росте не превышает 2n,
+    // поэтому время на одну вставку не должно расти вместе с n
+    const size_t n = 10000000;
+    s21::vector<int> vector;
+    size_t transfers = 0;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < n; ++i) {
+            if (vector.size() == vector.capacity()) transfers += vector.size();
+            vector.push_back(static_cast<int>(i));
+        }
+    });
+    s21_bench::report("s21::vector<int>::push_back 10^7", n, ms);
+    ASSERT_EQ(vector.size(), n);
+    ASSERT_LT(transfers, 2 * n);
+}
+
+TEST(s21_vector_bench, reserve_relocation) {
+    const size_t n = 50000000;
+    s21::vector<int> vector(n);
+    double ms = s21_bench::elapsed_ms([&] { vector.reserve(n * 2); });
+    s21_bench::report("s21::vector<int>::reserve relocation", n, ms);
+    std::cout << "[  BENCH   ] relocation throughput " << (n * sizeof(int) / 1e6) / ms << " GB/s"
+              << std::endl;
+    ASSERT_EQ(vector.size(), n);
+}
+
+TEST(s21_vector_bench, insert_middle) {
+    const size_t n = 1000000;
+    const size_t inserts = 200;
+    s21::vector<double> vector(n);
+    vector.reserve(n + inserts);
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < inserts; ++i) vector.insert(vector.begin() + n / 2, 1.0);
+    });
+    s21_bench::report("s21::vector<double>::insert middle", inserts, ms);
+    std::cout << "[  BENCH   ] shift throughput " << (inserts * n / 2 * sizeof(double) / 1e6) / ms << " GB/s"
+              << std::endl;
+    ASSERT_EQ(vector.size(), n + inserts);
+}
+
+TEST(s21_vector_bench, splice_sorted_batches) {
+    const size_t n = 1000000;
+    const size_t batches = 100;
+    const size_t batch_size = 1000;
+    s21::vector<int> vector(n);
+    std::vector<int> batch(batch_size, 1);
+    double range_ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < batches; ++i) {
+            vector.insert(vector.begin() + n / 2, batch.begin(), batch.end());
+        }
+    });
+    s21_bench::report("s21::vector<int>::insert range", batches * batch_size, range_ms);
+    double erase_ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < batches; ++i) {
+            vector.erase(vector.begin() + n / 2, vector.begin() + n / 2 + batch_size);
+        }
+    });
+    s21_bench::report("s21::vector<int>::erase range", batches * batch_size, erase_ms);
+    double erase_if_ms = s21_bench::elapsed_ms([&] { vector.erase_if([](int value) { return value & 1; }); });
+    s21_bench::report("s21::vector<int>::erase_if", n, erase_if_ms);
+    ASSERT_EQ(vector.size(), n);
+}
+
+namespace {
+
+// Объем анонимной памяти процесса, отображенной huge pages, в КБ
+size_t vector_bench_anon_huge_kb() {
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string key;
+    size_t value = 0;
+    while (smaps >> key) {
+        if (key == "AnonHugePages:") {
+            smaps >> value;
+            break;
+        }
+    }
+    return value;
+}
+
+template <class Vector>
+double vector_bench_random_access(size_t n, size_t accesses, uint64_t *checksum) {
+    Vector vector;
+    vector.reserve(n);
+    for (size_t i = 0; i < n; ++i) vector.push_back(i);
+    uint64_t sum = 0;
+    uint64_t state = 88172645463325252ull;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t i = 0; i < accesses; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            sum += vector[state % n];
+        }
+    });
+    std::cout << "[  BENCH   ]   AnonHugePages " << vector_bench_anon_huge_kb() / 1024 << " MB" << std::endl;
+    *checksum = sum;
+    return ms;
+}
+
+}  // namespace
+
+TEST(s21_vector_bench, random_access_huge_pages) {
+    // 512 МБ случайных чтений: с обычными страницами почти каждое обращение промахивается мимо TLB
+    const size_t n = 64 << 20;
+    const size_t accesses = 20000000;
+    uint64_t plain_sum = 0;
+    uint64_t huge_sum = 0;
+    double plain_ms = vector_bench_random_access<s21::vector<uint64_t>>(n, accesses, &plain_sum);
+    s21_bench::report("s21::vector<uint64_t> random access", accesses, plain_ms);
+    double huge_ms = vector_bench_random_access<s21::vector<uint64_t, s21::huge_page_vector_storage<>>>(
+        n, accesses, &huge_sum);
+    s21_bench::report("s21::vector<uint64_t> huge pages random", accesses, huge_ms);
+    ASSERT_EQ(plain_sum, huge_sum);
+}
+
+TEST(s21_vector_bench, clear_and_refill) {
+    const size_t cycles = 10000;
+    const size_t n = 1000;
+    s21::vector<int> vector;
+    size_t before = s21_bench::allocations.load();
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t cycle = 0; cycle < cycles; ++cycle) {
+            vector.clear();
+            for (size_t i = 0; i < n; ++i) vector.push_back(static_cast<int>(i));
+        }
+    });
+    s21_bench::report("s21::vector<int> clear + refill", cycles * n, ms);
+    std::cout << "[  BENCH   ]   allocations " << s21_bench::allocations.load() - before << std::endl;
+}
+
+template <class Vector>
+void vector_bench_scratch(const std::string &name) {
+    // Обработчик запроса: временный вектор, заполняемый на каждой итерации
+    const size_t requests = 200000;
+    size_t before = s21_bench::allocations.load();
+    size_t total = 0;
+    double ms = s21_bench::elapsed_ms([&] {
+        for (size_t r = 0; r < requests; ++r) {
+            Vector scratch;
+            for (size_t i = 0; i < 64 + r % 200; ++i) scratch.push_back(static_cast<int>(i));
+            total += scratch.size();
+        }
+    });
+    s21_bench::do_not_optimize(total);
+    s21_bench::report(name, requests, ms);
+    std::cout << "[  BENCH   ]   allocations " << s21_bench::allocations.load() - before << std::endl;
+}
+
+TEST(s21_vector_bench, scratch_vectors) {
+    vector_bench_scratch<s21::vector<int>>("s21::vector<int> scratch");
+    using recycled_vector = s21::vector<int, s21::recycling_vector_storage<>>;
+    vector_bench_scratch<recycled_vector>("s21::vector<int> recycled scratch");
+}
+
+namespace {
+
+// Рост вектора до n элементов в дочернем процессе: пиковый RSS процесса не уменьшается,
+// поэтому каждый вариант замеряется в своем процессе относительно RSS в момент fork
+template <class Vector>
+void vector_bench_growth_peak_rss(const std::string &name, size_t n) {
+    std::cout.flush();
+    pid_t pid = ::fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        struct rusage before;
+        ::getrusage(RUSAGE_SELF, &before);
+        double ms = s21_bench::elapsed_ms([n] {
+            Vector vector;
+            for (size_t i = 0; i < n; ++i) vector.push_back(i);
+            s21_bench::do_not_optimize(vector.data());
+        });
+        struct rusage after;
+        ::getrusage(RUSAGE_SELF, &after);
+        s21_bench::report(name, n, ms);
+        std::cout << "[  BENCH   ]   peak RSS " << (after.ru_maxrss - before.ru_maxrss) << " KB for "
+                  << n * sizeof(uint64_t) / 1024 << " KB of elements" << std::endl;
+        std::_Exit(0);
+    }
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+}
+
+}  // namespace
+
+TEST(s21_vector_bench, mremap_growth) {
+    // Цель - рост до 8 ГБ; здесь чуть больше 512 МБ, чтобы уложиться в память тестовой машины.
+    // Последний элемент вызывает перенос, при котором копирование держит оба буфера одновременно
+    const size_t n = (size_t(1) << 26) + 1;
+    vector_bench_growth_peak_rss<s21::vector<uint64_t>>("s21::vector<uint64_t> mremap growth", n);
+    vector_bench_growth_peak_rss<s21::vector<uint64_t, s21::copying_vector_storage>>(
+        "s21::vector<uint64_t> copying growth", n);
+}
+
+TEST(s21_vector_bench, growth_policies) {
+    // Хранилище без mremap, чтобы каждый перенос копировал элементы и держал оба буфера. Последний
+    // элемент вызывает перенос: пик - старый буфер плюс новый емкости grow()
+    const size_t n = (size_t(1) << 24) + 1;
+    using storage = s21::copying_vector_storage;
+    vector_bench_growth_peak_rss<s21::vector<uint64_t, storage, s21::doubling_growth>>(
+        "s21::vector<uint64_t> doubling_growth", n);
+    vector_bench_growth_peak_rss<s21::vector<uint64_t, storage, s21::half_growth>>(
+        "s21::vector<uint64_t> half_growth", n);
+    vector_bench_growth_peak_rss<s21::vector<uint64_t, storage, s21::page_growth>>(
+        "s21::vector<uint64_t> page_growth", n);
+    // exact_growth переносит вектор на каждом push_back, поэтому n на три порядка меньше
+    vector_bench_growth_peak_rss<s21::vector<uint64_t, storage, s21::exact_growth>>(
+        "s21::vector<uint64_t> exact_growth", n >> 10);
+}
+
+TEST(s21_vector_bench, shrinking_growth) {
+    // Очередь, которая разрастается до n и опустошается до n / 64: без сжатия емкость остается пиковой
+    const size_t n = 10000000;
+    using shrinking =
+        s21::vector<uint64_t, s21::default_vector_storage, s21::shrinking_growth<s21::doubling_growth>>;
+    s21::vector<uint64_t> plain;
+    shrinking shrunk;
+    auto fill_and_drain = [n](auto &vector) {
+        for (size_t i = 0; i < n; ++i) vector.push_back(i);
+        while (vector.size() > n / 64) vector.pop_back();
+    };
+    double plain_ms = s21_bench::elapsed_ms([&] { fill_and_drain(plain); });
+    double shrunk_ms = s21_bench::elapsed_ms([&] { fill_and_drain(shrunk); });
+    s21_bench::report("s21::vector<uint64_t> push/pop doubling", 2 * n, plain_ms);
+    s21_bench::report("s21::vector<uint64_t> push/pop shrinking", 2 * n, shrunk_ms);
+    std::cout << "[  BENCH   ]   retained capacity " << plain.capacity() << " vs " << shrunk.capacity()
+              << " for " << shrunk.size() << " elements" << std::endl;
+    ASSERT_LE(shrunk.capacity(), 4 * shrunk.size());
+}
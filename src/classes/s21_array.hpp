@@ -1,8 +1,11 @@
 #ifndef S21_CONTAINERS_S21_ARRAY_HPP
 #define S21_CONTAINERS_S21_ARRAY_HPP
 
+#include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 template <typename T, std::size_t N>
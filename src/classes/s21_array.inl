@@ -13,7 +13,11 @@ Array<T, N>::Array(std::initializer_list<T> const &iterms) {
 template <typename T, std::size_t N>
 Array<T, N>::Array(const Array &a) {
     if (this != &a) {
-        for (size_type i = 0; i < sizeArray; ++i) dataArray[i] = a.dataArray[i];
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(dataArray, a.dataArray, sizeof(dataArray));
+        } else {
+            for (size_type i = 0; i < sizeArray; ++i) dataArray[i] = a.dataArray[i];
+        }
     }
 }
 
@@ -28,7 +32,11 @@ Array<T, N>::~Array() {}
 template <typename T, std::size_t N>
 Array<T, N> &Array<T, N>::operator=(Array &&a) {
     if (this != &a) {
-        for (size_type i = 0; i < sizeArray; ++i) dataArray[i] = a.dataArray[i];
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(dataArray, a.dataArray, sizeof(dataArray));
+        } else {
+            for (size_type i = 0; i < sizeArray; ++i) dataArray[i] = std::move_if_noexcept(a.dataArray[i]);
+        }
     }
     return *this;
 }
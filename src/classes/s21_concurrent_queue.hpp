@@ -0,0 +1,74 @@
+#ifndef S21_CONTAINERS_S21_CONCURRENT_QUEUE_HPP
+#define S21_CONTAINERS_S21_CONCURRENT_QUEUE_HPP
+
+#include <atomic>  // NOLINT(build/c++11)
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Ограниченная очередь без блокировок для нескольких производителей и потребителей. Ячейки
+// кольцевого буфера выделяются один раз в конструкторе, у каждой есть счетчик sequence_: он
+// показывает, для какой позиции ячейка свободна или заполнена. Поток занимает позицию одним
+// compare_exchange над enqueue_pos_ или dequeue_pos_ и работает с ячейкой, не дожидаясь других.
+// Память ячеек освобождается только деструктором, поэтому безопасное освобождение узлов между
+// потоками не нужно. Элементы переносятся перемещением, которое не должно бросать исключений
+template <typename T>
+class concurrent_queue {
+    static_assert(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+                  "Elements must be nothrow movable");
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types are not supported");
+
+ public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+    explicit concurrent_queue(size_type capacity = 1024);  // Емкость округляется вверх до степени двойки
+    concurrent_queue(const concurrent_queue &) = delete;
+    concurrent_queue &operator=(const concurrent_queue &) = delete;
+    ~concurrent_queue();  // Разрушает оставшиеся элементы и освобождает ячейки
+
+    bool try_push(const_reference value);  // Добавляет копию value, false - очередь заполнена
+    bool try_push(value_type &&value);     // Перемещает value в очередь, false - очередь заполнена
+    bool try_pop(reference value);         // Извлекает первый элемент в value, false - очередь пуста
+    template <class InputIt>
+    size_type push_n(InputIt first, size_type count);  // Перемещает до count элементов, возвращает сколько
+    template <class OutputIt>
+    size_type pop_n(OutputIt out, size_type count);  // Извлекает до count элементов в out, возвращает сколько
+
+    size_type size() const;      // Приблизительное количество элементов при одновременной работе
+    bool empty() const;          // Приблизительная проверка на пустоту
+    size_type capacity() const;  // Количество ячеек
+
+ private:
+    static constexpr size_type cache_line_ = 64;
+
+    struct cell {
+        std::atomic<size_type> sequence_;  // pos - свободна для позиции pos, pos + 1 - заполнена ей
+        alignas(value_type) unsigned char storage_[sizeof(value_type)];
+
+        value_type *data();  // Место элемента ячейки
+    };
+
+    cell *cells_;
+    size_type mask_;  // Емкость - 1, ячейка позиции pos - cells_[pos & mask_]
+    alignas(cache_line_) std::atomic<size_type> enqueue_pos_;  // Следующая позиция записи
+    alignas(cache_line_) std::atomic<size_type> dequeue_pos_;  // Следующая позиция чтения
+
+    // Занимают до count позиций подряд одним compare_exchange, возвращают первую и их количество
+    std::pair<size_type, size_type> claim_push(size_type count);
+    std::pair<size_type, size_type> claim_pop(size_type count);
+    void release_pop(size_type pos);  // Разрушает элемент позиции pos и освобождает ячейку для записи
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_queue.inl"
+
+#endif  // S21_CONTAINERS_S21_CONCURRENT_QUEUE_HPP
@@ -0,0 +1,180 @@
+#include "s21_concurrent_queue.hpp"
+
+namespace s21 {
+
+template <typename T>
+concurrent_queue<T>::concurrent_queue(size_type capacity) : enqueue_pos_(0), dequeue_pos_(0) {
+    if (capacity == 0) throw std::invalid_argument("Queue must hold at least one element");
+    if (capacity > (std::numeric_limits<size_type>::max() >> 1) / sizeof(cell)) {
+        throw std::length_error("Queue has exceeded the maximum size values");
+    }
+    size_type n = 1;
+    while (n < capacity) n <<= 1;
+    mask_ = n - 1;
+    cells_ = static_cast<cell *>(::operator new(n * sizeof(cell)));
+    for (size_type i = 0; i < n; ++i) new (&cells_[i].sequence_) std::atomic<size_type>(i);
+}
+
+template <typename T>
+concurrent_queue<T>::~concurrent_queue() {
+    size_type last = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed); pos != last; ++pos) {
+        cell &c = cells_[pos & mask_];
+        if (c.sequence_.load(std::memory_order_relaxed) == pos + 1) c.data()->~value_type();
+    }
+    ::operator delete(cells_);
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_push(const_reference value) {
+    if constexpr (std::is_nothrow_copy_constructible<value_type>::value) {
+        std::pair<size_type, size_type> claimed = claim_push(1);
+        if (!claimed.second) return false;
+        cell &c = cells_[claimed.first & mask_];
+        new (c.data()) value_type(value);
+        c.sequence_.store(claimed.first + 1, std::memory_order_release);
+        return true;
+    } else {
+        // Копия создается до занятия ячейки: исключение конструктора не должно оставить занятую
+        // ячейку пустой, иначе потребители остановятся на ней
+        value_type copy(value);
+        return try_push(std::move(copy));
+    }
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_push(value_type &&value) {
+    std::pair<size_type, size_type> claimed = claim_push(1);
+    if (!claimed.second) return false;
+    cell &c = cells_[claimed.first & mask_];
+    new (c.data()) value_type(std::move(value));
+    c.sequence_.store(claimed.first + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_pop(reference value) {
+    std::pair<size_type, size_type> claimed = claim_pop(1);
+    if (!claimed.second) return false;
+    value = std::move(*cells_[claimed.first & mask_].data());
+    release_pop(claimed.first);
+    return true;
+}
+
+template <typename T>
+template <class InputIt>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::push_n(InputIt first, size_type count) {
+    static_assert(std::is_nothrow_constructible<value_type, decltype(std::move(*first))>::value,
+                  "push_n moves elements and requires a nothrow conversion");
+    if (count == 0) return 0;
+    std::pair<size_type, size_type> claimed = claim_push(count);
+    for (size_type i = 0; i < claimed.second; ++i, ++first) {
+        cell &c = cells_[(claimed.first + i) & mask_];
+        new (c.data()) value_type(std::move(*first));
+        c.sequence_.store(claimed.first + i + 1, std::memory_order_release);
+    }
+    return claimed.second;
+}
+
+template <typename T>
+template <class OutputIt>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::pop_n(OutputIt out, size_type count) {
+    if (count == 0) return 0;
+    std::pair<size_type, size_type> claimed = claim_pop(count);
+    size_type i = 0;
+    try {
+        for (; i < claimed.second; ++i) {
+            *out = std::move(*cells_[(claimed.first + i) & mask_].data());
+            ++out;
+            release_pop(claimed.first + i);
+        }
+    } catch (...) {
+        // Занятые ячейки освобождаются в любом случае, иначе очередь остановится на них;
+        // элементы, не попавшие в out, теряются
+        for (; i < claimed.second; ++i) release_pop(claimed.first + i);
+        throw;
+    }
+    return claimed.second;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::size() const {
+    size_type tail = dequeue_pos_.load(std::memory_order_acquire);
+    size_type head = enqueue_pos_.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+}
+
+template <typename T>
+bool concurrent_queue<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::capacity() const {
+    return mask_ + 1;
+}
+
+// private
+
+template <typename T>
+typename concurrent_queue<T>::value_type *concurrent_queue<T>::cell::data() {
+    return reinterpret_cast<value_type *>(storage_);
+}
+
+template <typename T>
+std::pair<typename concurrent_queue<T>::size_type, typename concurrent_queue<T>::size_type>
+concurrent_queue<T>::claim_push(size_type count) {
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        // Ячейка свободна для позиции pos, если ее sequence_ равен pos; меньшее значение значит,
+        // что элемент прошлого круга еще не прочитан и очередь заполнена
+        size_type sequence = cells_[pos & mask_].sequence_.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff < 0) return {pos, 0};
+        if (diff > 0) {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+            continue;
+        }
+        size_type ready = 1;
+        while (ready < count &&
+               cells_[(pos + ready) & mask_].sequence_.load(std::memory_order_acquire) == pos + ready) {
+            ++ready;
+        }
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+            return {pos, ready};
+        }
+    }
+}
+
+template <typename T>
+std::pair<typename concurrent_queue<T>::size_type, typename concurrent_queue<T>::size_type>
+concurrent_queue<T>::claim_pop(size_type count) {
+    size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        // Ячейка заполнена для позиции pos, если ее sequence_ равен pos + 1
+        size_type sequence = cells_[pos & mask_].sequence_.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+        if (diff < 0) return {pos, 0};
+        if (diff > 0) {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+            continue;
+        }
+        size_type ready = 1;
+        while (ready < count &&
+               cells_[(pos + ready) & mask_].sequence_.load(std::memory_order_acquire) == pos + ready + 1) {
+            ++ready;
+        }
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+            return {pos, ready};
+        }
+    }
+}
+
+template <typename T>
+void concurrent_queue<T>::release_pop(size_type pos) {
+    cell &c = cells_[pos & mask_];
+    c.data()->~value_type();
+    c.sequence_.store(pos + mask_ + 1, std::memory_order_release);
+}
+
+}  // namespace s21
@@ -0,0 +1,73 @@
+#ifndef S21_CONTAINERS_S21_CONCURRENT_VECTOR_HPP
+#define S21_CONTAINERS_S21_CONCURRENT_VECTOR_HPP
+
+#include <atomic>  // NOLINT(build/c++11)
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+
+namespace s21 {
+
+// Вектор только для добавления, в который одновременно пишут несколько потоков. Элементы лежат
+// в сегментах, каждый следующий вдвое больше предыдущего; сегменты не переносятся, поэтому адреса
+// элементов стабильны. push_back занимает индекс одним fetch_add и не ждет другие потоки, кроме
+// редкого выделения нового сегмента: его выделяет один поток, остальные ждут публикации. Элемент
+// доступен другим потокам после публикации: чтение индекса, полученного от push_back через
+// синхронизацию, или проверка is_published()
+template <typename T>
+class concurrent_vector {
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types are not supported");
+
+ public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = size_t;
+
+    concurrent_vector();  // Конструктор по умолчанию
+    concurrent_vector(const concurrent_vector &) = delete;
+    concurrent_vector &operator=(const concurrent_vector &) = delete;
+    ~concurrent_vector();  // Разрушает опубликованные элементы и освобождает сегменты
+
+    reference at(size_type pos);          // Опубликованный элемент, иначе std::out_of_range
+    reference operator[](size_type pos);  // Элемент по индексу, который уже опубликован
+    bool is_published(size_type pos);     // Элемент pos создан и виден текущему потоку
+
+    size_type push_back(const_reference value);  // Добавляет копию value, возвращает ее индекс
+    size_type push_back(value_type &&value);     // Перемещает value в конец, возвращает индекс
+    template <class... Args>
+    size_type emplace_back(Args &&...args);  // Создает элемент из args, возвращает индекс
+
+    size_type size();              // Количество занятых индексов, включая еще не опубликованные
+    bool empty();                  // Нет ни одного занятого индекса
+    size_type capacity();          // Количество элементов в выделенных сегментах
+    void reserve(size_type size);  // Выделяет сегменты под size элементов
+    void clear();  // Разрушает элементы, сохраняя сегменты. Не должен выполняться одновременно с другими
+
+ private:
+    static constexpr size_type first_segment_bits_ = 5;
+    static constexpr size_type first_segment_size_ = size_type(1) << first_segment_bits_;
+    static constexpr size_type max_segments_ = 64 - first_segment_bits_;
+
+    std::atomic<value_type *> segments_[max_segments_];  // Сегмент: элементы, за ними флаги публикации
+    std::atomic<size_type> size_;
+
+    static size_type segment_of(size_type pos);      // Номер сегмента, содержащего pos
+    static size_type segment_begin(size_type k);     // Первый индекс сегмента k
+    static size_type segment_size(size_type k);      // Количество элементов в сегменте k
+    static value_type *allocating();  // Метка сегмента, который сейчас выделяет другой поток
+    static std::atomic<unsigned char> *flags(value_type *segment, size_type k);  // Флаги сегмента k
+    value_type *segment(size_type k);   // Сегмент k, выделяемый при первом обращении
+    value_type *slot(size_type pos);    // Место элемента pos, выделяет его сегмент при необходимости
+    value_type *published_slot(size_type pos);  // Место опубликованного элемента pos, только чтение сегмента
+    std::atomic<unsigned char> &flag(size_type pos);  // Флаг публикации элемента pos
+    void destroy_elements();            // Разрушает опубликованные элементы
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_vector.inl"
+
+#endif  // S21_CONTAINERS_S21_CONCURRENT_VECTOR_HPP
@@ -0,0 +1,181 @@
+#include "s21_concurrent_vector.hpp"
+
+namespace s21 {
+
+template <typename T>
+concurrent_vector<T>::concurrent_vector() : size_(0) {
+    for (auto &segment : segments_) segment.store(nullptr, std::memory_order_relaxed);
+}
+
+template <typename T>
+concurrent_vector<T>::~concurrent_vector() {
+    destroy_elements();
+    for (size_type k = 0; k < max_segments_; ++k) {
+        ::operator delete(segments_[k].load(std::memory_order_relaxed));
+    }
+}
+
+template <typename T>
+typename concurrent_vector<T>::reference concurrent_vector<T>::at(size_type pos) {
+    if (!is_published(pos)) {
+        throw std::out_of_range("The specified element is outside the bounds of the vector");
+    }
+    return *published_slot(pos);
+}
+
+template <typename T>
+typename concurrent_vector<T>::reference concurrent_vector<T>::operator[](size_type pos) {
+    return *published_slot(pos);
+}
+
+template <typename T>
+bool concurrent_vector<T>::is_published(size_type pos) {
+    if (pos >= size_.load(std::memory_order_acquire)) return false;
+    size_type k = segment_of(pos);
+    value_type *s = segments_[k].load(std::memory_order_acquire);
+    return s && s != allocating() && flags(s, k)[pos - segment_begin(k)].load(std::memory_order_acquire);
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::push_back(const_reference value) {
+    return emplace_back(value);
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::push_back(value_type &&value) {
+    return emplace_back(std::move(value));
+}
+
+template <typename T>
+template <class... Args>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::emplace_back(Args &&...args) {
+    // Если конструктор бросит исключение, индекс останется занятым, но не опубликованным
+    size_type pos = size_.fetch_add(1, std::memory_order_relaxed);
+    new (slot(pos)) value_type(std::forward<Args>(args)...);
+    flag(pos).store(1, std::memory_order_release);
+    return pos;
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::size() {
+    return size_.load(std::memory_order_acquire);
+}
+
+template <typename T>
+bool concurrent_vector<T>::empty() {
+    return size() == 0;
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::capacity() {
+    size_type result = 0;
+    for (size_type k = 0; k < max_segments_; ++k) {
+        value_type *s = segments_[k].load(std::memory_order_acquire);
+        if (s == nullptr || s == allocating()) break;
+        result += segment_size(k);
+    }
+    return result;
+}
+
+template <typename T>
+void concurrent_vector<T>::reserve(size_type size) {
+    for (size_type k = 0; k < max_segments_ && segment_begin(k) < size; ++k) segment(k);
+}
+
+template <typename T>
+void concurrent_vector<T>::clear() {
+    destroy_elements();
+    size_.store(0, std::memory_order_release);
+}
+
+// private
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::segment_of(size_type pos) {
+    return 63 - __builtin_clzll((pos >> first_segment_bits_) + 1);
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::segment_begin(size_type k) {
+    return first_segment_size_ * ((size_type(1) << k) - 1);
+}
+
+template <typename T>
+typename concurrent_vector<T>::size_type concurrent_vector<T>::segment_size(size_type k) {
+    return first_segment_size_ << k;
+}
+
+template <typename T>
+std::atomic<unsigned char> *concurrent_vector<T>::flags(value_type *segment, size_type k) {
+    return reinterpret_cast<std::atomic<unsigned char> *>(segment + segment_size(k));
+}
+
+template <typename T>
+typename concurrent_vector<T>::value_type *concurrent_vector<T>::allocating() {
+    return reinterpret_cast<value_type *>(alignof(value_type));
+}
+
+template <typename T>
+typename concurrent_vector<T>::value_type *concurrent_vector<T>::segment(size_type k) {
+    value_type *s = segments_[k].load(std::memory_order_acquire);
+    if (s && s != allocating()) return s;
+    // Сегмент выделяет только поток, заменивший nullptr на метку allocating(); остальные
+    // уступают процессор, пока он не опубликует сегмент
+    if (s == nullptr &&
+        segments_[k].compare_exchange_strong(s, allocating(), std::memory_order_acquire,
+                                             std::memory_order_acquire)) {
+        size_type n = segment_size(k);
+        value_type *fresh;
+        try {
+            fresh = static_cast<value_type *>(::operator new(n * sizeof(value_type) + n));
+        } catch (...) {
+            segments_[k].store(nullptr, std::memory_order_release);
+            throw;
+        }
+        std::atomic<unsigned char> *f = flags(fresh, k);
+        for (size_type i = 0; i < n; ++i) new (f + i) std::atomic<unsigned char>(0);
+        segments_[k].store(fresh, std::memory_order_release);
+        return fresh;
+    }
+    // Если выделение у владельца метки не удалось, метка снимается и сегмент выделяет
+    // следующий обратившийся поток
+    while ((s = segments_[k].load(std::memory_order_acquire)) == allocating()) std::this_thread::yield();
+    return s ? s : segment(k);
+}
+
+template <typename T>
+typename concurrent_vector<T>::value_type *concurrent_vector<T>::slot(size_type pos) {
+    size_type k = segment_of(pos);
+    return segment(k) + (pos - segment_begin(k));
+}
+
+template <typename T>
+typename concurrent_vector<T>::value_type *concurrent_vector<T>::published_slot(size_type pos) {
+    // Сегмент опубликованного элемента уже выделен, поэтому чтение не доходит до segment()
+    size_type k = segment_of(pos);
+    return segments_[k].load(std::memory_order_acquire) + (pos - segment_begin(k));
+}
+
+template <typename T>
+std::atomic<unsigned char> &concurrent_vector<T>::flag(size_type pos) {
+    size_type k = segment_of(pos);
+    return flags(segment(k), k)[pos - segment_begin(k)];
+}
+
+template <typename T>
+void concurrent_vector<T>::destroy_elements() {
+    size_type size = size_.load(std::memory_order_acquire);
+    for (size_type k = 0; k < max_segments_ && segment_begin(k) < size; ++k) {
+        value_type *s = segments_[k].load(std::memory_order_acquire);
+        if (s == nullptr) continue;
+        std::atomic<unsigned char> *f = flags(s, k);
+        for (size_type i = 0; i < segment_size(k) && segment_begin(k) + i < size; ++i) {
+            if (f[i].load(std::memory_order_relaxed)) {
+                s[i].~value_type();
+                f[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+}  // namespace s21
@@ -0,0 +1,79 @@
+#ifndef S21_CONTAINERS_S21_DYNAMIC_BITSET_HPP
+#define S21_CONTAINERS_S21_DYNAMIC_BITSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "s21_simd.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Набор бит переменной длины, упакованный в 64-битные слова: один бит на флаг вместо байта
+// у vector<bool>. Биты последнего слова за пределами size() всегда равны нулю
+class dynamic_bitset {
+ public:
+    using word_type = uint64_t;
+    using size_type = size_t;
+
+    static constexpr size_type bits_per_word = 64;
+    static constexpr size_type npos = static_cast<size_type>(-1);  // результат поиска без находки
+
+    dynamic_bitset();                                           // Конструктор по умолчанию
+    explicit dynamic_bitset(size_type n, bool value = false);  // n бит, равных value
+    dynamic_bitset(const dynamic_bitset &other) = default;     // Конструктор копирования
+    dynamic_bitset(dynamic_bitset &&other) noexcept;           // Конструктор перемещения
+    ~dynamic_bitset() = default;                               // Деструктор
+    dynamic_bitset &operator=(const dynamic_bitset &other);    // Перегрузка опреатора присваивания
+    dynamic_bitset &operator=(dynamic_bitset &&other) noexcept;  // Перегрузка опреатора присваивания
+
+    bool test(size_type pos);        // значение бита с проверкой границ
+    bool operator[](size_type pos);  // значение бита
+    dynamic_bitset &set();           // устанавливает все биты
+    dynamic_bitset &set(size_type pos, bool value = true);  // устанавливает бит pos в value
+    dynamic_bitset &reset();                                // сбрасывает все биты
+    dynamic_bitset &reset(size_type pos);                   // сбрасывает бит pos
+    dynamic_bitset &flip();                                 // инвертирует все биты
+    dynamic_bitset &flip(size_type pos);                    // инвертирует бит pos
+
+    size_type size();       // количество бит
+    size_type num_words();  // количество слов хранилища
+    bool empty();           // проверка на отсутствие бит
+    void resize(size_type n, bool value = false);  // меняет количество бит, новые равны value
+    void push_back(bool value);                    // добавляет бит в конец
+    void clear();                                  // удаляет все биты, сохраняя емкость
+    word_type *data();                             // доступ к словам хранилища
+
+    size_type count();  // количество установленных бит (popcnt)
+    bool any();         // установлен хотя бы один бит
+    bool none();        // не установлено ни одного бита
+    bool all();         // установлены все биты
+
+    size_type find_first();              // позиция первого установленного бита или npos
+    size_type find_next(size_type pos);  // позиция следующего после pos установленного бита или npos
+
+    // Пословные операции над наборами одинаковой длины, иначе std::invalid_argument
+    dynamic_bitset &operator&=(dynamic_bitset &other);
+    dynamic_bitset &operator|=(dynamic_bitset &other);
+    dynamic_bitset &operator^=(dynamic_bitset &other);
+    dynamic_bitset &and_not(dynamic_bitset &other);  // *this &= ~other
+    bool operator==(dynamic_bitset &other);
+
+ private:
+    size_type size_;
+    vector<word_type> words_;
+
+    static size_type words_for(size_type bits);  // Количество слов для bits бит
+    word_type &word(size_type pos);              // Слово, содержащее бит pos
+    static word_type mask(size_type pos);        // Маска бита pos внутри слова
+    void trim_last_word();                       // Обнуляет биты последнего слова за пределами size_
+    void check_same_size(dynamic_bitset &other);  // Бросает std::invalid_argument при разной длине
+    size_type scan_from(size_type index);         // Первый установленный бит в словах с index
+};
+
+}  // namespace s21
+
+#include "s21_dynamic_bitset.inl"
+
+#endif  // S21_CONTAINERS_S21_DYNAMIC_BITSET_HPP
@@ -0,0 +1,217 @@
+#include "s21_dynamic_bitset.hpp"
+
+namespace s21 {
+
+inline dynamic_bitset::dynamic_bitset() : size_(0) {}
+
+inline dynamic_bitset::dynamic_bitset(size_type n, bool value) : size_(n), words_(words_for(n)) {
+    if (value) set();
+}
+
+inline dynamic_bitset::dynamic_bitset(dynamic_bitset &&other) noexcept
+    : size_(other.size_), words_(std::move(other.words_)) {
+    other.size_ = 0;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator=(const dynamic_bitset &other) {
+    if (this != &other) {
+        size_ = other.size_;
+        words_ = other.words_;
+    }
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator=(dynamic_bitset &&other) noexcept {
+    if (this != &other) {
+        size_ = other.size_;
+        words_ = std::move(other.words_);
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+inline bool dynamic_bitset::test(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("The specified bit is outside the bounds of the bitset");
+    return (*this)[pos];
+}
+
+inline bool dynamic_bitset::operator[](size_type pos) {
+    return (word(pos) & mask(pos)) != 0;
+}
+
+inline dynamic_bitset &dynamic_bitset::set() {
+    for (word_type &w : words_) w = ~word_type(0);
+    trim_last_word();
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::set(size_type pos, bool value) {
+    if (pos >= size_) throw std::out_of_range("The specified bit is outside the bounds of the bitset");
+    if (value) {
+        word(pos) |= mask(pos);
+    } else {
+        word(pos) &= ~mask(pos);
+    }
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::reset() {
+    for (word_type &w : words_) w = 0;
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::reset(size_type pos) {
+    return set(pos, false);
+}
+
+inline dynamic_bitset &dynamic_bitset::flip() {
+    for (word_type &w : words_) w = ~w;
+    trim_last_word();
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::flip(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("The specified bit is outside the bounds of the bitset");
+    word(pos) ^= mask(pos);
+    return *this;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::size() {
+    return size_;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::num_words() {
+    return words_.size();
+}
+
+inline bool dynamic_bitset::empty() {
+    return size_ == 0;
+}
+
+inline void dynamic_bitset::resize(size_type n, bool value) {
+    size_type old_size = size_;
+    size_type words = words_for(n);
+    if (words > words_.size()) {
+        words_.insert(words_.end(), words - words_.size(), value ? ~word_type(0) : word_type(0));
+    } else if (words < words_.size()) {
+        words_.erase(words_.begin() + words, words_.end());
+    }
+    size_ = n;
+    // Новые биты в бывшем последнем слове: выше old_size там нули
+    if (value && n > old_size && old_size % bits_per_word) {
+        size_type last = std::min(n, words_for(old_size) * bits_per_word);
+        for (size_type pos = old_size; pos < last; ++pos) word(pos) |= mask(pos);
+    }
+    trim_last_word();
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+    if (size_ % bits_per_word == 0) words_.push_back(0);
+    ++size_;
+    if (value) word(size_ - 1) |= mask(size_ - 1);
+}
+
+inline void dynamic_bitset::clear() {
+    words_.clear();
+    size_ = 0;
+}
+
+inline dynamic_bitset::word_type *dynamic_bitset::data() {
+    return words_.data();
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::count() {
+    return simd::popcount(words_.begin(), words_.end());
+}
+
+inline bool dynamic_bitset::any() {
+    return scan_from(0) != npos;
+}
+
+inline bool dynamic_bitset::none() {
+    return !any();
+}
+
+inline bool dynamic_bitset::all() {
+    return count() == size_;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::find_first() {
+    return scan_from(0);
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::find_next(size_type pos) {
+    if (pos == npos || ++pos >= size_) return npos;
+    // Биты ниже pos в его слове отбрасываются сдвигом, дальше поиск идет целыми словами
+    word_type rest = word(pos) >> (pos % bits_per_word);
+    if (rest) return pos + __builtin_ctzll(rest);
+    return scan_from(pos / bits_per_word + 1);
+}
+
+inline dynamic_bitset &dynamic_bitset::operator&=(dynamic_bitset &other) {
+    check_same_size(other);
+    word_type *a = words_.data();
+    word_type *b = other.words_.data();
+    for (size_type i = 0, n = words_.size(); i < n; ++i) a[i] &= b[i];
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator|=(dynamic_bitset &other) {
+    check_same_size(other);
+    word_type *a = words_.data();
+    word_type *b = other.words_.data();
+    for (size_type i = 0, n = words_.size(); i < n; ++i) a[i] |= b[i];
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::operator^=(dynamic_bitset &other) {
+    check_same_size(other);
+    word_type *a = words_.data();
+    word_type *b = other.words_.data();
+    for (size_type i = 0, n = words_.size(); i < n; ++i) a[i] ^= b[i];
+    return *this;
+}
+
+inline dynamic_bitset &dynamic_bitset::and_not(dynamic_bitset &other) {
+    check_same_size(other);
+    word_type *a = words_.data();
+    word_type *b = other.words_.data();
+    for (size_type i = 0, n = words_.size(); i < n; ++i) a[i] &= ~b[i];
+    return *this;
+}
+
+inline bool dynamic_bitset::operator==(dynamic_bitset &other) {
+    return size_ == other.size_ && simd::equal(words_.begin(), words_.end(), other.words_.begin());
+}
+
+// private
+
+inline dynamic_bitset::size_type dynamic_bitset::words_for(size_type bits) {
+    return (bits + bits_per_word - 1) / bits_per_word;
+}
+
+inline dynamic_bitset::word_type &dynamic_bitset::word(size_type pos) {
+    return words_[pos / bits_per_word];
+}
+
+inline dynamic_bitset::word_type dynamic_bitset::mask(size_type pos) {
+    return word_type(1) << (pos % bits_per_word);
+}
+
+inline void dynamic_bitset::trim_last_word() {
+    if (size_ % bits_per_word) words_[words_.size() - 1] &= mask(size_) - 1;
+}
+
+inline void dynamic_bitset::check_same_size(dynamic_bitset &other) {
+    if (size_ != other.size_) throw std::invalid_argument("Bitsets have different sizes");
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::scan_from(size_type index) {
+    word_type *w = words_.data();
+    for (size_type n = words_.size(); index < n; ++index) {
+        if (w[index]) return index * bits_per_word + __builtin_ctzll(w[index]);
+    }
+    return npos;
+}
+
+}  // namespace s21
@@ -0,0 +1,151 @@
+#ifndef S21_CONTAINERS_S21_INTRUSIVE_LIST_HPP
+#define S21_CONTAINERS_S21_INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Звено, встраиваемое в объект, чтобы объект можно было связать в s21::intrusive_list. Копирование
+// объекта звено не переносит: копия создается несвязанной. Объект должен быть исключен из списка
+// раньше, чем будет разрушен
+class intrusive_list_hook {
+ public:
+    intrusive_list_hook();
+    intrusive_list_hook(const intrusive_list_hook &other);             // Создает несвязанное звено
+    intrusive_list_hook &operator=(const intrusive_list_hook &other);  // Оставляет звено как есть
+
+    bool is_linked() const;  // входит ли объект в какой-либо список
+
+ private:
+    template <class T, intrusive_list_hook T::*Hook>
+    friend class intrusive_list;
+
+    intrusive_list_hook *next_;
+    intrusive_list_hook *previous_;
+};
+
+// Список, связывающий уже существующие объекты через их звено Hook. Список не владеет объектами,
+// не копирует их и никогда не выделяет память: вставка, удаление, splice и сортировка только
+// переставляют указатели звеньев. Любой объект списка исключается за O(1) через erase(value).
+// Один объект может входить в несколько списков, если у него несколько звеньев
+template <class T, intrusive_list_hook T::*Hook>
+class intrusive_list {
+ public:
+    template <bool Const>
+    class basic_iterator;
+
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using size_type = size_t;
+
+    intrusive_list();                                   // Конструктор по умолчанию
+    intrusive_list(const intrusive_list &l) = delete;  // Объект не может быть в двух копиях списка
+    intrusive_list(intrusive_list &&l) noexcept;        // Конструктор перемещения
+    ~intrusive_list();                                  // Деструктор, исключает все объекты
+    intrusive_list &operator=(intrusive_list &&l) noexcept;  // Перегрузка опреатора присваивания
+    intrusive_list &operator=(const intrusive_list &l) = delete;
+
+    reference front();  // Доступ к первому элементу
+    reference back();   // Доступ к последнему элементу
+
+    iterator begin();  // Возвращает итератор в начало
+    iterator end();    // Возвращает итератор в конец
+    const_iterator begin() const;
+    const_iterator end() const;
+    iterator iterator_to(reference value);  // итератор на объект этого списка, O(1)
+
+    bool empty() const;          // проверка контейнера на пустоту
+    size_type size() const;      // возвращает количество элементов
+    size_type max_size() const;  // возвращает максимально возможное количество элементов
+
+    void clear();  // исключает все объекты, не разрушая их
+    iterator insert(const_iterator pos, reference value);  // связывает value перед pos
+    iterator erase(const_iterator pos);  // исключает объект, возвращает итератор на следующий
+    void erase(reference value);         // исключает объект этого списка, где бы он ни стоял
+    void push_back(reference value);     // связывает объект в конце
+    void pop_back();                     // исключает последний объект
+    void push_front(reference value);    // связывает объект в начале
+    void pop_front();                    // исключает первый объект
+    void swap(intrusive_list &other);    // меняет содержимое
+    void merge(intrusive_list &other);   // сливает отсортированный other в отсортированный список
+    template <class Compare>
+    void merge(intrusive_list &other, Compare comp);
+    void splice(const_iterator pos, intrusive_list &other);  // переносит объекты other перед pos
+    void splice(const_iterator pos, intrusive_list &other, const_iterator it);
+    void splice(const_iterator pos, intrusive_list &other, const_iterator first, const_iterator last);
+    void reverse();      // обращает порядок объектов
+    size_type unique();  // исключает соседние повторы, возвращает количество исключенных
+    template <class BinaryPredicate>
+    size_type unique(BinaryPredicate pred);
+    void sort();  // устойчивая сортировка слиянием
+    template <class Compare>
+    void sort(Compare comp);
+
+    template <bool Const>
+    class basic_iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator();
+        // Преобразование iterator в const_iterator
+        template <bool Other, typename = std::enable_if_t<Const && !Other>>
+        basic_iterator(const basic_iterator<Other> &other);  // NOLINT(runtime/explicit)
+
+        reference operator*() const;
+        pointer operator->() const;
+        basic_iterator &operator++();
+        basic_iterator operator++(int);
+        basic_iterator &operator--();
+        basic_iterator operator--(int);
+        bool operator==(const basic_iterator &other) const;
+        bool operator!=(const basic_iterator &other) const;
+
+     private:
+        friend class intrusive_list;
+        friend class basic_iterator<!Const>;
+
+        explicit basic_iterator(intrusive_list_hook *node);
+
+        intrusive_list_hook *node_;
+    };
+
+ private:
+    intrusive_list_hook root_;  // Ограничитель кольца звеньев, end() списка
+    size_type size_;
+
+    static const std::ptrdiff_t hook_offset_;  // Смещение звена Hook от начала T
+
+    static intrusive_list_hook *hook_of(reference value);  // Звено объекта
+    static T *owner_of(intrusive_list_hook *hook);        // Объект, в который встроено звено
+    static std::ptrdiff_t member_offset();                // Смещение, записанное в указателе Hook
+    static void link_before(intrusive_list_hook *pos, intrusive_list_hook *first,
+                            intrusive_list_hook *last);  // Вставляет цепочку [first, last] перед pos
+    static void unlink_hooks(intrusive_list_hook *first,
+                             intrusive_list_hook *last);  // Вырезает цепочку [first, last]
+    template <class Compare>
+    static intrusive_list_hook *merge_hooks(intrusive_list_hook *left, intrusive_list_hook *right,
+                                            Compare &comp);  // Сливает цепочки по next_
+    intrusive_list_hook *detach_hooks();     // Размыкает кольцо в цепочку по next_, size_ не меняется
+    void link_hooks(intrusive_list_hook *first);  // Замыкает цепочку по next_ на root_
+    void take_hooks(intrusive_list &other);       // Забирает звенья other в пустой список
+};
+
+}  // namespace s21
+
+#include "s21_intrusive_list.inl"
+
+#endif  // S21_CONTAINERS_S21_INTRUSIVE_LIST_HPP
@@ -0,0 +1,469 @@
+#include "s21_intrusive_list.hpp"
+
+namespace s21 {
+
+// intrusive_list_hook
+
+inline intrusive_list_hook::intrusive_list_hook() : next_(nullptr), previous_(nullptr) {}
+
+inline intrusive_list_hook::intrusive_list_hook(const intrusive_list_hook &) : intrusive_list_hook() {}
+
+inline intrusive_list_hook &intrusive_list_hook::operator=(const intrusive_list_hook &) {
+    return *this;
+}
+
+inline bool intrusive_list_hook::is_linked() const {
+    return next_ != nullptr;
+}
+
+// basic_iterator
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+intrusive_list<T, Hook>::basic_iterator<Const>::basic_iterator() : node_(nullptr) {}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+template <bool Other, typename>
+intrusive_list<T, Hook>::basic_iterator<Const>::basic_iterator(const basic_iterator<Other> &other)
+    : node_(other.node_) {}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+intrusive_list<T, Hook>::basic_iterator<Const>::basic_iterator(intrusive_list_hook *node) : node_(node) {}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>::reference
+intrusive_list<T, Hook>::basic_iterator<Const>::operator*() const {
+    return *owner_of(node_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>::pointer
+intrusive_list<T, Hook>::basic_iterator<Const>::operator->() const {
+    return owner_of(node_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>
+    &intrusive_list<T, Hook>::basic_iterator<Const>::operator++() {
+    node_ = node_->next_;
+    return *this;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>
+intrusive_list<T, Hook>::basic_iterator<Const>::operator++(int) {
+    basic_iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>
+    &intrusive_list<T, Hook>::basic_iterator<Const>::operator--() {
+    node_ = node_->previous_;
+    return *this;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+typename intrusive_list<T, Hook>::template basic_iterator<Const>
+intrusive_list<T, Hook>::basic_iterator<Const>::operator--(int) {
+    basic_iterator result(*this);
+    --*this;
+    return result;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+bool intrusive_list<T, Hook>::basic_iterator<Const>::operator==(const basic_iterator &other) const {
+    return node_ == other.node_;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <bool Const>
+bool intrusive_list<T, Hook>::basic_iterator<Const>::operator!=(const basic_iterator &other) const {
+    return node_ != other.node_;
+}
+
+// intrusive_list
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() : size_(0) {
+    root_.next_ = &root_;
+    root_.previous_ = &root_;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&l) noexcept : intrusive_list() {
+    take_hooks(l);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+    clear();
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(intrusive_list &&l) noexcept {
+    if (this != &l) {
+        clear();
+        take_hooks(l);
+    }
+    return *this;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::front() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    return *owner_of(root_.next_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference intrusive_list<T, Hook>::back() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    return *owner_of(root_.previous_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() {
+    return iterator(root_.next_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() {
+    return iterator(&root_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::begin() const {
+    return const_iterator(root_.next_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator intrusive_list<T, Hook>::end() const {
+    return const_iterator(const_cast<intrusive_list_hook *>(&root_));
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::iterator_to(reference value) {
+    return iterator(hook_of(value));
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const {
+    return size_ == 0;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size() const {
+    return size_;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+    for (intrusive_list_hook *hook = root_.next_; hook != &root_;) {
+        intrusive_list_hook *next = hook->next_;
+        hook->next_ = nullptr;
+        hook->previous_ = nullptr;
+        hook = next;
+    }
+    root_.next_ = &root_;
+    root_.previous_ = &root_;
+    size_ = 0;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(const_iterator pos,
+                                                                           reference value) {
+    intrusive_list_hook *hook = hook_of(value);
+    if (hook->is_linked()) throw std::invalid_argument("The object is already linked into a list");
+    link_before(pos.node_, hook, hook);
+    ++size_;
+    return iterator(hook);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(const_iterator pos) {
+    intrusive_list_hook *hook = pos.node_;
+    intrusive_list_hook *next = hook->next_;
+    unlink_hooks(hook, hook);
+    hook->next_ = nullptr;
+    hook->previous_ = nullptr;
+    --size_;
+    return iterator(next);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::erase(reference value) {
+    intrusive_list_hook *hook = hook_of(value);
+    if (!hook->is_linked()) throw std::invalid_argument("The object is not linked into a list");
+    erase(const_iterator(hook));
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) {
+    insert(end(), value);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    erase(const_iterator(root_.previous_));
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) {
+    insert(begin(), value);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    erase(begin());
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) {
+    if (this != &other) {
+        intrusive_list tmp(std::move(other));
+        other.take_hooks(*this);
+        take_hooks(tmp);
+    }
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::merge(intrusive_list &other) {
+    merge(other, std::less<T>());
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list &other, Compare comp) {
+    if (this == &other || other.size_ == 0) return;
+    link_hooks(merge_hooks(detach_hooks(), other.detach_hooks(), comp));
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other) {
+    if (this == &other || other.size_ == 0) return;
+    intrusive_list_hook *first = other.root_.next_;
+    intrusive_list_hook *last = other.root_.previous_;
+    unlink_hooks(first, last);
+    link_before(pos.node_, first, last);
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other, const_iterator it) {
+    intrusive_list_hook *hook = it.node_;
+    if (pos.node_ == hook || pos.node_ == hook->next_) return;
+    unlink_hooks(hook, hook);
+    link_before(pos.node_, hook, hook);
+    --other.size_;
+    ++size_;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other, const_iterator first,
+                                     const_iterator last) {
+    if (first == last) return;
+    intrusive_list_hook *first_hook = first.node_;
+    intrusive_list_hook *last_hook = last.node_->previous_;
+    if (this != &other) {
+        // Размер диапазона известен только после обхода, перенос звеньев от длины не зависит
+        size_type count = 1;
+        for (intrusive_list_hook *hook = first_hook; hook != last_hook; hook = hook->next_) ++count;
+        other.size_ -= count;
+        size_ += count;
+    }
+    unlink_hooks(first_hook, last_hook);
+    link_before(pos.node_, first_hook, last_hook);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::reverse() {
+    // Обход кольца вместе с root_: у каждого звена, включая ограничитель, меняются местами ссылки
+    intrusive_list_hook *hook = &root_;
+    do {
+        std::swap(hook->next_, hook->previous_);
+        hook = hook->previous_;
+    } while (hook != &root_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <class BinaryPredicate>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::unique(BinaryPredicate pred) {
+    if (size_ == 0) return 0;
+    size_type count = 0;
+    intrusive_list_hook *kept = root_.next_;
+    for (intrusive_list_hook *hook = kept->next_; hook != &root_;) {
+        intrusive_list_hook *next = hook->next_;
+        if (pred(*owner_of(kept), *owner_of(hook))) {
+            hook->next_ = nullptr;
+            hook->previous_ = nullptr;
+            ++count;
+        } else {
+            kept->next_ = hook;
+            hook->previous_ = kept;
+            kept = hook;
+        }
+        hook = next;
+    }
+    kept->next_ = &root_;
+    root_.previous_ = kept;
+    size_ -= count;
+    return count;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::sort() {
+    sort(std::less<T>());
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+    // Восходящая сортировка слиянием, как в s21::list: bins[i] хранит отсортированную цепочку
+    // из 2^i звеньев, более ранние звенья лежат в корзинах с большим номером
+    intrusive_list_hook *bins[64] = {};
+    size_type used = 0;
+    intrusive_list_hook *hook = detach_hooks();
+    while (hook) {
+        intrusive_list_hook *run = hook;
+        hook = hook->next_;
+        run->next_ = nullptr;
+        size_type i = 0;
+        for (; i < used && bins[i]; ++i) {
+            run = merge_hooks(bins[i], run, comp);
+            bins[i] = nullptr;
+        }
+        bins[i] = run;
+        if (i == used) ++used;
+    }
+    intrusive_list_hook *result = nullptr;
+    for (size_type i = 0; i < used; ++i) {
+        if (bins[i]) result = result ? merge_hooks(bins[i], result, comp) : bins[i];
+    }
+    link_hooks(result);
+}
+
+// private
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list_hook *intrusive_list<T, Hook>::hook_of(reference value) {
+    return &(value.*Hook);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+const std::ptrdiff_t intrusive_list<T, Hook>::hook_offset_ = intrusive_list<T, Hook>::member_offset();
+
+template <class T, intrusive_list_hook T::*Hook>
+T *intrusive_list<T, Hook>::owner_of(intrusive_list_hook *hook) {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) - hook_offset_);
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+std::ptrdiff_t intrusive_list<T, Hook>::member_offset() {
+    // В Itanium C++ ABI (GCC, Clang) указатель на член-данное хранит смещение члена от начала
+    // объекта, поэтому смещение читается из самого Hook, без обращения к объекту T
+    static_assert(sizeof(Hook) == sizeof(std::ptrdiff_t), "Unsupported pointer to member layout");
+    intrusive_list_hook T::*hook = Hook;
+    std::ptrdiff_t offset;
+    std::memcpy(&offset, &hook, sizeof(offset));
+    return offset;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::link_before(intrusive_list_hook *pos, intrusive_list_hook *first,
+                                          intrusive_list_hook *last) {
+    first->previous_ = pos->previous_;
+    last->next_ = pos;
+    pos->previous_->next_ = first;
+    pos->previous_ = last;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink_hooks(intrusive_list_hook *first, intrusive_list_hook *last) {
+    // Ссылки самих звеньев цепочки не меняются, их перезаписывает link_before или вызывающий
+    first->previous_->next_ = last->next_;
+    last->next_->previous_ = first->previous_;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+template <class Compare>
+intrusive_list_hook *intrusive_list<T, Hook>::merge_hooks(intrusive_list_hook *left,
+                                                          intrusive_list_hook *right, Compare &comp) {
+    // При равенстве первым идет звено left, что сохраняет устойчивость
+    intrusive_list_hook *head = nullptr;
+    intrusive_list_hook **last = &head;
+    while (left && right) {
+        if (comp(*owner_of(right), *owner_of(left))) {
+            *last = right;
+            right = right->next_;
+        } else {
+            *last = left;
+            left = left->next_;
+        }
+        last = &(*last)->next_;
+    }
+    *last = left ? left : right;
+    return head;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+intrusive_list_hook *intrusive_list<T, Hook>::detach_hooks() {
+    if (size_ == 0) return nullptr;
+    intrusive_list_hook *first = root_.next_;
+    root_.previous_->next_ = nullptr;
+    root_.next_ = &root_;
+    root_.previous_ = &root_;
+    return first;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::link_hooks(intrusive_list_hook *first) {
+    // Восстанавливает previous_ по цепочке next_ и замыкает ее на root_
+    intrusive_list_hook *previous = &root_;
+    for (intrusive_list_hook *hook = first; hook; hook = hook->next_) {
+        hook->previous_ = previous;
+        previous->next_ = hook;
+        previous = hook;
+    }
+    previous->next_ = &root_;
+    root_.previous_ = previous;
+}
+
+template <class T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::take_hooks(intrusive_list &other) {
+    if (other.size_ == 0) return;
+    root_.next_ = other.root_.next_;
+    root_.previous_ = other.root_.previous_;
+    root_.next_->previous_ = &root_;
+    root_.previous_->next_ = &root_;
+    size_ = other.size_;
+    other.root_.next_ = &other.root_;
+    other.root_.previous_ = &other.root_;
+    other.size_ = 0;
+}
+
+}  // namespace s21
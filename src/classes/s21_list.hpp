@@ -1,11 +1,17 @@
 #ifndef S21_CONTAINERS_S21_LIST_HPP
 #define S21_CONTAINERS_S21_LIST_HPP
 
+#include <cstddef>
 #include <cstring>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 #include <limits>
 
+#include "s21_list_pool.hpp"
+
 namespace s21 {
 
 template <class T>
@@ -22,7 +28,9 @@ struct list_item {
 template <class T>
 class list {
  public:
-    class ListIterator;
+    template <bool Const> class BasicListIterator;
+    using ListIterator = BasicListIterator<false>;
+    using ListConstIterator = BasicListIterator<true>;
 
     // member types
 
@@ -30,25 +38,43 @@ class list {
     using reference = T &;
     using const_reference = const T &;
     using iterator = ListIterator;
-    using const_iterator = const ListIterator;
+    using const_iterator = ListConstIterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     using size_type = size_t;
 
     // iterator
 
-    class ListIterator {
+    // Разыменование возвращает ссылку на элемент узла, без копирования. Итератор конца хранит
+    // nullptr и указатель на список, поэтому --end() переходит к последнему элементу
+    template <bool Const>
+    class BasicListIterator {
      public:
-        explicit ListIterator(list_item<T> *ptr = nullptr);
-        T operator*() const;
-        void operator++();
-        void operator--();
-        bool operator==(iterator iter2) const;
-        bool operator!=(iterator iter2) const;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        explicit BasicListIterator(list_item<T> *ptr = nullptr, const list *list_ptr = nullptr);
+        template <bool Other, typename = std::enable_if_t<Const && !Other>>
+        BasicListIterator(const BasicListIterator<Other> &other);  // NOLINT(runtime/explicit)
+        reference operator*() const;
+        pointer operator->() const;
+        BasicListIterator &operator++();
+        BasicListIterator operator++(int);
+        BasicListIterator &operator--();
+        BasicListIterator operator--(int);
+        template <bool Other> bool operator==(const BasicListIterator<Other> &iter2) const;
+        template <bool Other> bool operator!=(const BasicListIterator<Other> &iter2) const;
         list_item<T> *ptr_;
+        const list *list_ptr_;
     };
 
     // public methods
 
     list();
+    explicit list(list_node_pool<T> &pool);  // узлы берутся из pool, в том числе у копий списка
     explicit list(size_type n);
     explicit list(std::initializer_list<value_type> const &items);
     list(const list &l);
@@ -59,26 +85,40 @@ class list {
     const_reference front() const;
     const_reference back() const;
 
-    iterator begin() const;
-    iterator end() const;
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
 
     bool empty() const;
     size_type size() const;
     size_type max_size() const;
+    list_node_pool<T> *pool() const;
 
     void clear();
-    iterator insert(iterator pos, const_reference value);
-    void erase(iterator pos);
+    iterator insert(const_iterator pos, const_reference value);
+    void erase(const_iterator pos);
     void push_back(const_reference value);
     void pop_back();
     void push_front(const_reference value);
     void pop_front();
     void swap(list& other);
     void merge(list& other);
+    template <class Compare> void merge(list& other, Compare comp);
     void splice(const_iterator pos, list& other);
+    void splice(const_iterator pos, list& other, const_iterator it);
+    void splice(const_iterator pos, list& other, const_iterator first, const_iterator last);
     void reverse();
-    void unique();
+    size_type unique();
+    template <class BinaryPredicate> size_type unique(BinaryPredicate pred);
     void sort();
+    template <class Compare> void sort(Compare comp);
 
     iterator emplace(const_iterator pos);
     template <typename... Args> iterator emplace(const_iterator pos, Args&&... args);
@@ -91,8 +131,16 @@ class list {
     list_item<T> *head_;
     list_item<T> *tail_;
     size_type size_;
-
-    void swap_elements(iterator pos1, iterator pos2);
+    list_node_pool<T> *pool_;
+
+    list_item<T> *create_item(const_reference value, list_item<T> *next, list_item<T> *previous);
+    void destroy_item(list_item<T> *item);
+    void destroy_items(list_item<T> *first);
+    template <class Compare>
+    static list_item<T> *merge_items(list_item<T> *left, list_item<T> *right, Compare &comp);
+    void link_items(list_item<T> *first);
+    void unlink_items(list_item<T> *first, list_item<T> *last);
+    void link_before(list_item<T> *pos, list_item<T> *first, list_item<T> *last);
 };
 
 }  // namespace s21
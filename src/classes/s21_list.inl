@@ -2,34 +2,74 @@
 
 namespace s21 {
 
-// ListIterator
+// BasicListIterator
 
 template <class T>
-list<T>::ListIterator::ListIterator(list_item<T> *ptr)
-    : ptr_(ptr) {}
+template <bool Const>
+list<T>::BasicListIterator<Const>::BasicListIterator(list_item<T> *ptr, const list *list_ptr)
+    : ptr_(ptr), list_ptr_(list_ptr) {}
 
 template <class T>
-T list<T>::ListIterator::operator*() const {
-    return (ptr_) ? ptr_->data_ : 0;
+template <bool Const>
+template <bool Other, typename>
+list<T>::BasicListIterator<Const>::BasicListIterator(const BasicListIterator<Other> &other)
+    : ptr_(other.ptr_), list_ptr_(other.list_ptr_) {}
+
+template <class T>
+template <bool Const>
+typename list<T>::template BasicListIterator<Const>::reference
+list<T>::BasicListIterator<Const>::operator*() const {
+    return ptr_->data_;
+}
+
+template <class T>
+template <bool Const>
+typename list<T>::template BasicListIterator<Const>::pointer
+list<T>::BasicListIterator<Const>::operator->() const {
+    return &ptr_->data_;
+}
+
+template <class T>
+template <bool Const>
+typename list<T>::template BasicListIterator<Const> &list<T>::BasicListIterator<Const>::operator++() {
+    ptr_ = ptr_->next_;
+    return *this;
 }
 
 template <class T>
-void list<T>::ListIterator::operator++() {
-    ptr_ = (ptr_) ? ptr_->next_ : nullptr;
+template <bool Const>
+typename list<T>::template BasicListIterator<Const> list<T>::BasicListIterator<Const>::operator++(int) {
+    BasicListIterator result(*this);
+    ptr_ = ptr_->next_;
+    return result;
 }
 
 template <class T>
-void list<T>::ListIterator::operator--() {
-    ptr_ = (ptr_) ? ptr_->previous_ : nullptr;
+template <bool Const>
+typename list<T>::template BasicListIterator<Const> &list<T>::BasicListIterator<Const>::operator--() {
+    ptr_ = (ptr_) ? ptr_->previous_ : list_ptr_->tail_;
+    return *this;
 }
 
 template <class T>
-bool list<T>::ListIterator::operator==(iterator iter2) const {
+template <bool Const>
+typename list<T>::template BasicListIterator<Const> list<T>::BasicListIterator<Const>::operator--(int) {
+    BasicListIterator result(*this);
+    --*this;
+    return result;
+}
+
+template <class T>
+template <bool Const>
+template <bool Other>
+bool list<T>::BasicListIterator<Const>::operator==(const BasicListIterator<Other> &iter2) const {
     return (ptr_ == iter2.ptr_);
 }
 
 template <class T>
-bool list<T>::ListIterator::operator!=(iterator iter2) const {
+template <bool Const>
+template <bool Other>
+bool list<T>::BasicListIterator<Const>::operator!=(const BasicListIterator<Other> &iter2) const {
     return (ptr_ != iter2.ptr_);
 }
 
@@ -39,7 +79,13 @@ template <class T>
 list<T>::list()
     : head_(nullptr)
     , tail_(nullptr)
-    , size_(0) {}
+    , size_(0)
+    , pool_(nullptr) {}
+
+template <class T>
+list<T>::list(list_node_pool<T> &pool) : list() {
+    pool_ = &pool;
+}
 
 template <class T>
 list<T>::list(size_type n)  : list() {
@@ -57,6 +103,7 @@ list<T>::list(std::initializer_list<T> const &items) : list() {
 
 template <class T>
 list<T>::list(const list<T> &l) : list() {
+    pool_ = l.pool_;
     list_item<T> *item = l.head_;
     while (item) {
         push_back(item->data_);
@@ -65,7 +112,7 @@ list<T>::list(const list<T> &l) : list() {
 }
 
 template <class T>
-list<T>::list(list<T> &&l) {
+list<T>::list(list<T> &&l) : list() {
     *this = std::move(l);
 }
 
@@ -77,10 +124,8 @@ list<T>::~list() {
 template <class T>
 list<T> & list<T>::operator=(list<T> &&l) {
     if (this != &l) {
+        clear();
         swap(l);
-        l.head_ = nullptr;
-        l.tail_ = nullptr;
-        l.size_ = 0;
     }
     return *this;
 }
@@ -96,13 +141,53 @@ typename list<T>::const_reference list<T>::back() const {
 }
 
 template <class T>
-typename list<T>::iterator list<T>::begin() const {
-    return iterator(head_);
+typename list<T>::iterator list<T>::begin() {
+    return iterator(head_, this);
+}
+
+template <class T>
+typename list<T>::iterator list<T>::end() {
+    return iterator(nullptr, this);
+}
+
+template <class T>
+typename list<T>::const_iterator list<T>::begin() const {
+    return const_iterator(head_, this);
+}
+
+template <class T>
+typename list<T>::const_iterator list<T>::end() const {
+    return const_iterator(nullptr, this);
+}
+
+template <class T>
+typename list<T>::const_iterator list<T>::cbegin() const {
+    return begin();
+}
+
+template <class T>
+typename list<T>::const_iterator list<T>::cend() const {
+    return end();
 }
 
 template <class T>
-typename list<T>::iterator list<T>::end() const {
-    return iterator(nullptr);
+typename list<T>::reverse_iterator list<T>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <class T>
+typename list<T>::reverse_iterator list<T>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <class T>
+typename list<T>::const_reverse_iterator list<T>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <class T>
+typename list<T>::const_reverse_iterator list<T>::rend() const {
+    return const_reverse_iterator(begin());
 }
 
 template <class T>
@@ -120,25 +205,27 @@ typename list<T>::size_type list<T>::max_size() const {
     return std::numeric_limits<size_type>::max() / (sizeof(list_item<T>) * 2);
 }
 
+template <class T>
+list_node_pool<T> *list<T>::pool() const {
+    return pool_;
+}
+
 template <class T>
 void list<T>::clear() {
-    while (head_) {
-        list_item<T> * cls = head_;
-        head_ = head_->next_;
-        delete cls;
-    }
+    destroy_items(head_);
+    head_ = nullptr;
     tail_ = nullptr;
     size_ = 0;
 }
 
 template <class T>
-typename list<T>::iterator list<T>::insert(iterator pos, const_reference value) {
+typename list<T>::iterator list<T>::insert(const_iterator pos, const_reference value) {
     iterator result;
     if (!pos.ptr_) {
         push_back(value);
-        result = end();
+        result = iterator(tail_, this);
     } else {
-        list_item<T> *ins = new list_item<T>(value, pos.ptr_, pos.ptr_->previous_);
+        list_item<T> *ins = create_item(value, pos.ptr_, pos.ptr_->previous_);
         if (pos != begin()) {
             pos.ptr_->previous_->next_ = ins;
         } else {
@@ -146,13 +233,13 @@ typename list<T>::iterator list<T>::insert(iterator pos, const_reference value)
         }
         pos.ptr_->previous_ = ins;
         ++size_;
-        result = iterator(ins);
+        result = iterator(ins, this);
     }
     return result;
 }
 
 template <class T>
-void list<T>::erase(iterator pos) {
+void list<T>::erase(const_iterator pos) {
     if (size_ == 1) {
         clear();
     }
@@ -168,14 +255,14 @@ void list<T>::erase(iterator pos) {
             pos.ptr_->previous_->next_ = pos.ptr_->next_;
             pos.ptr_->next_->previous_ = pos.ptr_->previous_;
         }
-        delete cls;
+        destroy_item(cls);
         --size_;
     }
 }
 
 template <class T>
 void list<T>::push_back(const_reference value) {
-    list_item<T> *item = new list_item<T>(value, nullptr, nullptr);
+    list_item<T> *item = create_item(value, nullptr, nullptr);
     if (!head_) {
         head_ = item;
     }
@@ -190,7 +277,7 @@ void list<T>::push_back(const_reference value) {
 template <class T>
 void list<T>::pop_back() {
     if (size_ > 0) {
-        erase(iterator(tail_));
+        erase(const_iterator(tail_, this));
     }
 }
 
@@ -211,67 +298,280 @@ void list<T>::swap(list& other) {
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
+    std::swap(pool_, other.pool_);
 }
 
 template <class T>
 void list<T>::merge(list& other) {
-    for (auto it = other.begin(); it != other.end(); ++it) {
-        push_back(*it);
+    merge(other, std::less<T>());
+}
+
+template <class T>
+template <class Compare>
+void list<T>::merge(list& other, Compare comp) {
+    if (this == &other || !other.head_) return;
+    if (pool_ != other.pool_) {
+        // Узлы чужого пула нельзя освобождать в свой, поэтому значения копируются в узлы этого списка
+        list<T> copy;
+        copy.pool_ = pool_;
+        for (list_item<T> *item = other.head_; item; item = item->next_) {
+            copy.push_back(item->data_);
+        }
+        other.clear();
+        merge(copy, comp);
+        return;
     }
-    other.clear();
+    link_items(merge_items(head_, other.head_, comp));
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
 }
 
 template <class T>
 void list<T>::splice(const_iterator pos, list& other) {
-    for (auto it = other.begin(); it != other.end(); ++it) {
-        insert(pos, *it);
+    if (this == &other || !other.head_) return;
+    if (pool_ != other.pool_) {
+        // Узлы чужого пула нельзя освобождать в свой, поэтому значения копируются
+        for (auto it = other.begin(); it != other.end(); ++it) {
+            insert(pos, *it);
+        }
+        other.clear();
+        return;
+    }
+    link_before(pos.ptr_, other.head_, other.tail_);
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+}
+
+template <class T>
+void list<T>::splice(const_iterator pos, list& other, const_iterator it) {
+    list_item<T> *item = it.ptr_;
+    // Без перестановки только внутри одного списка: у хвоста другого списка next_ тоже равен end()
+    if (this == &other && (pos.ptr_ == item || pos.ptr_ == item->next_)) return;
+    if (pool_ != other.pool_) {
+        insert(pos, item->data_);
+        other.erase(it);
+        return;
+    }
+    other.unlink_items(item, item);
+    link_before(pos.ptr_, item, item);
+    --other.size_;
+    ++size_;
+}
+
+template <class T>
+void list<T>::splice(const_iterator pos, list& other, const_iterator first, const_iterator last) {
+    if (first == last) return;
+    if (pool_ != other.pool_) {
+        for (auto it = first; it != last;) {
+            auto next = it;
+            ++next;
+            insert(pos, *it);
+            other.erase(it);
+            it = next;
+        }
+        return;
+    }
+    list_item<T> *first_item = first.ptr_;
+    list_item<T> *last_item = last.ptr_ ? last.ptr_->previous_ : other.tail_;
+    if (this != &other) {
+        // Размер диапазона известен только после обхода, перенос узлов от длины не зависит
+        size_type count = 1;
+        for (list_item<T> *item = first_item; item != last_item; item = item->next_) ++count;
+        other.size_ -= count;
+        size_ += count;
     }
-    other.clear();
+    other.unlink_items(first_item, last_item);
+    link_before(pos.ptr_, first_item, last_item);
 }
 
 template <class T>
 void list<T>::reverse() {
-    auto pos1 = begin();
-    auto pos2 = iterator(tail_);
-    while (pos1 != pos2) {
-        swap_elements(pos1, pos2);
-        ++pos1;
-        if (pos1 == pos2) break;
-        --pos2;
+    for (list_item<T> *item = head_; item; item = item->previous_) {
+        std::swap(item->next_, item->previous_);
     }
+    std::swap(head_, tail_);
 }
 
 template <class T>
-void list<T>::unique() {
-    auto pos = begin();
-    ++pos;
-    for (; pos != end(); ++pos) {
-        for (auto cmp = begin(); cmp != pos; ++cmp) {
-            if (pos.ptr_->data_ == cmp.ptr_->data_) {
-                erase(pos);
-                break;
-            }
+typename list<T>::size_type list<T>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <class T>
+template <class BinaryPredicate>
+typename list<T>::size_type list<T>::unique(BinaryPredicate pred) {
+    // Один проход: узел, равный последнему оставленному, переходит в цепочку удаленных,
+    // которая разрушается целиком после прохода
+    if (!head_) return 0;
+    list_item<T> *removed = nullptr;
+    list_item<T> **removed_last = &removed;
+    size_type count = 0;
+    list_item<T> *kept = head_;
+    for (list_item<T> *item = head_->next_; item;) {
+        list_item<T> *next = item->next_;
+        if (pred(kept->data_, item->data_)) {
+            *removed_last = item;
+            removed_last = &item->next_;
+            ++count;
+        } else {
+            kept->next_ = item;
+            item->previous_ = kept;
+            kept = item;
         }
+        item = next;
     }
+    *removed_last = nullptr;
+    kept->next_ = nullptr;
+    tail_ = kept;
+    size_ -= count;
+    destroy_items(removed);
+    return count;
 }
 
 template <class T>
 void list<T>::sort() {
-    for (auto pos1 = begin(); pos1 != end(); ++pos1) {
-        auto pos2 = pos1;
-        ++pos2;
-        for (; pos2 != end(); ++pos2) {
-            if (pos2.ptr_->data_ < pos1.ptr_->data_) {
-                swap_elements(pos1, pos2);
-            }
+    sort(std::less<T>());
+}
+
+template <class T>
+template <class Compare>
+void list<T>::sort(Compare comp) {
+    // Восходящая сортировка слиянием: bins[i] хранит отсортированную цепочку из 2^i узлов, каждый
+    // новый узел сливается с заполненными корзинами, как при прибавлении единицы к счетчику.
+    // В корзинах с большим номером лежат более ранние узлы, поэтому они сливаются слева
+    list_item<T> *bins[64] = {};
+    size_type used = 0;
+    list_item<T> *item = head_;
+    while (item) {
+        list_item<T> *run = item;
+        item = item->next_;
+        run->next_ = nullptr;
+        size_type i = 0;
+        for (; i < used && bins[i]; ++i) {
+            run = merge_items(bins[i], run, comp);
+            bins[i] = nullptr;
+        }
+        bins[i] = run;
+        if (i == used) ++used;
+    }
+    list_item<T> *result = nullptr;
+    for (size_type i = 0; i < used; ++i) {
+        if (bins[i]) result = result ? merge_items(bins[i], result, comp) : bins[i];
+    }
+    link_items(result);
+}
+
+template <class T>
+list_item<T> *list<T>::create_item(const_reference value, list_item<T> *next, list_item<T> *previous) {
+    if (!pool_) return new list_item<T>(value, next, previous);
+    list_item<T> *item = pool_->allocate();
+    try {
+        return new (item) list_item<T>(value, next, previous);
+    } catch (...) {
+        pool_->deallocate(item);
+        throw;
+    }
+}
+
+template <class T>
+void list<T>::destroy_item(list_item<T> *item) {
+    if (pool_) {
+        // Узел остается цепочкой по next_, в пуле разрушается только значение
+        item->data_.~T();
+        pool_->deallocate(item);
+    } else {
+        delete item;
+    }
+}
+
+template <class T>
+void list<T>::destroy_items(list_item<T> *first) {
+    if (pool_ && first) {
+        // Значения разрушаются по одному, а цепочка возвращается в пул целиком
+        list_item<T> *last = first;
+        size_type count = 1;
+        first->data_.~T();
+        for (; last->next_; ++count) {
+            last = last->next_;
+            last->data_.~T();
+        }
+        pool_->deallocate_chain(first, last, count);
+        return;
+    }
+    while (first) {
+        list_item<T> *next = first->next_;
+        destroy_item(first);
+        first = next;
+    }
+}
+
+template <class T>
+template <class Compare>
+list_item<T> *list<T>::merge_items(list_item<T> *left, list_item<T> *right, Compare &comp) {
+    // Сливает цепочки по next_; при равенстве первым идет узел left, что сохраняет устойчивость
+    list_item<T> *head = nullptr;
+    list_item<T> **last = &head;
+    while (left && right) {
+        if (comp(right->data_, left->data_)) {
+            *last = right;
+            right = right->next_;
+        } else {
+            *last = left;
+            left = left->next_;
         }
+        last = &(*last)->next_;
     }
+    *last = left ? left : right;
+    return head;
 }
 
 template <class T>
-void list<T>::swap_elements(iterator pos1, iterator pos2) {
-    if (pos1 != pos2) {
-        std::swap(pos1.ptr_->data_, pos2.ptr_->data_);
+void list<T>::link_items(list_item<T> *first) {
+    // Восстанавливает previous_, head_ и tail_ по цепочке next_
+    head_ = first;
+    tail_ = nullptr;
+    for (list_item<T> *item = first; item; item = item->next_) {
+        item->previous_ = tail_;
+        tail_ = item;
+    }
+}
+
+template <class T>
+void list<T>::unlink_items(list_item<T> *first, list_item<T> *last) {
+    // Вырезает цепочку [first, last], не меняя size_
+    if (first->previous_) {
+        first->previous_->next_ = last->next_;
+    } else {
+        head_ = last->next_;
+    }
+    if (last->next_) {
+        last->next_->previous_ = first->previous_;
+    } else {
+        tail_ = first->previous_;
+    }
+    first->previous_ = nullptr;
+    last->next_ = nullptr;
+}
+
+template <class T>
+void list<T>::link_before(list_item<T> *pos, list_item<T> *first, list_item<T> *last) {
+    // Вставляет цепочку [first, last] перед pos, nullptr - в конец списка; size_ не меняется
+    list_item<T> *previous = pos ? pos->previous_ : tail_;
+    first->previous_ = previous;
+    last->next_ = pos;
+    if (previous) {
+        previous->next_ = first;
+    } else {
+        head_ = first;
+    }
+    if (pos) {
+        pos->previous_ = last;
+    } else {
+        tail_ = last;
     }
 }
 
@@ -0,0 +1,58 @@
+#ifndef S21_CONTAINERS_S21_LIST_POOL_HPP
+#define S21_CONTAINERS_S21_LIST_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+
+namespace s21 {
+
+template <class T>
+struct list_item;
+
+// Пул узлов s21::list. Узлы выдаются из непрерывных блоков по chunk_nodes штук: новые узлы идут
+// подряд, освобожденные попадают в список свободных, связанный через их поле next_, и выдаются
+// первыми; поэтому цепочка узлов списка возвращается в пул одной перестановкой указателя. Один
+// пул можно передать нескольким спискам, тогда их узлы лежат в общих блоках. Пул не потокобезопасен
+// и должен жить дольше всех списков, которые им пользуются; блоки освобождаются деструктором пула
+template <class T>
+class list_node_pool {
+ public:
+    using size_type = size_t;
+
+    explicit list_node_pool(size_type chunk_nodes = 1024);  // Конструктор с размером блока в узлах
+    list_node_pool(const list_node_pool &) = delete;
+    list_node_pool &operator=(const list_node_pool &) = delete;
+    ~list_node_pool();  // Освобождает все блоки
+
+    list_item<T> *allocate();                // Память под один узел, без вызова конструктора
+    void deallocate(list_item<T> *item);     // Возвращает узел с разрушенным значением в список свободных
+    void deallocate_chain(list_item<T> *first, list_item<T> *last,
+                          size_type count);  // Возвращает цепочку [first, last] по next_ из count узлов
+    size_type size() const;                  // Количество выданных узлов
+    size_type capacity() const;              // Количество узлов во всех блоках
+    size_type chunk_nodes() const;           // Количество узлов в одном блоке
+
+ private:
+    union slot {
+        slot *next;
+        alignas(list_item<T>) unsigned char storage[sizeof(list_item<T>)];
+    };
+    static_assert(alignof(slot) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types are not supported");
+
+    slot *chunks_;     // Последний блок; первый слот каждого блока хранит ссылку на предыдущий
+    list_item<T> *free_;  // Список освобожденных узлов по next_
+    slot *next_;       // Следующий еще не выданный слот последнего блока
+    slot *end_;        // Конец последнего блока
+    size_type chunk_nodes_;
+    size_type size_;
+    size_type capacity_;
+
+    void add_chunk();  // Выделяет новый блок
+};
+
+}  // namespace s21
+
+#include "s21_list_pool.inl"
+
+#endif  // S21_CONTAINERS_S21_LIST_POOL_HPP
@@ -0,0 +1,78 @@
+#include "s21_list_pool.hpp"
+
+namespace s21 {
+
+template <class T>
+list_node_pool<T>::list_node_pool(size_type chunk_nodes)
+    : chunks_(nullptr),
+      free_(nullptr),
+      next_(nullptr),
+      end_(nullptr),
+      chunk_nodes_(chunk_nodes),
+      size_(0),
+      capacity_(0) {
+    if (chunk_nodes == 0) throw std::invalid_argument("Chunk must hold at least one node");
+}
+
+template <class T>
+list_node_pool<T>::~list_node_pool() {
+    while (chunks_) {
+        slot *previous = chunks_->next;
+        ::operator delete(chunks_);
+        chunks_ = previous;
+    }
+}
+
+template <class T>
+list_item<T> *list_node_pool<T>::allocate() {
+    list_item<T> *result = free_;
+    if (result) {
+        free_ = result->next_;
+    } else {
+        if (next_ == end_) add_chunk();
+        result = reinterpret_cast<list_item<T> *>((next_++)->storage);
+    }
+    ++size_;
+    return result;
+}
+
+template <class T>
+void list_node_pool<T>::deallocate(list_item<T> *item) {
+    deallocate_chain(item, item, 1);
+}
+
+template <class T>
+void list_node_pool<T>::deallocate_chain(list_item<T> *first, list_item<T> *last, size_type count) {
+    last->next_ = free_;
+    free_ = first;
+    size_ -= count;
+}
+
+template <class T>
+typename list_node_pool<T>::size_type list_node_pool<T>::size() const {
+    return size_;
+}
+
+template <class T>
+typename list_node_pool<T>::size_type list_node_pool<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+typename list_node_pool<T>::size_type list_node_pool<T>::chunk_nodes() const {
+    return chunk_nodes_;
+}
+
+// private
+
+template <class T>
+void list_node_pool<T>::add_chunk() {
+    slot *chunk = static_cast<slot *>(::operator new((chunk_nodes_ + 1) * sizeof(slot)));
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    next_ = chunk + 1;
+    end_ = next_ + chunk_nodes_;
+    capacity_ += chunk_nodes_;
+}
+
+}  // namespace s21
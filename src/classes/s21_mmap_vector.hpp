@@ -0,0 +1,97 @@
+#ifndef S21_CONTAINERS_S21_MMAP_VECTOR_HPP
+#define S21_CONTAINERS_S21_MMAP_VECTOR_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>  // NOLINT(build/c++11)
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Вектор, элементы которого лежат в файле, отображенном в память. Открытие существующего файла
+// не читает его: страницы подгружаются ядром при первом обращении. Файл хранит ровно size()
+// элементов без заголовка; во время работы он может быть длиннее на резерв емкости
+template <typename T>
+class mmap_vector {
+    static_assert(std::is_trivially_copyable<T>::value, "mmap_vector requires a trivially copyable type");
+
+ public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using size_type = size_t;
+
+    enum class mode {
+        read_only,   // MAP_PRIVATE: записи элементов остаются в копиях страниц процесса и не доходят
+                     // до файла; методы, меняющие размер, бросают std::logic_error
+        read_write,  // PROT_READ | PROT_WRITE, файл создается при отсутствии
+    };
+
+    explicit mmap_vector(const std::string &path, mode m = mode::read_write);  // Отображает файл path
+    mmap_vector(const mmap_vector &v) = delete;
+    mmap_vector(mmap_vector &&v) noexcept;  // Конструктор перемещения
+    ~mmap_vector();  // Снимает отображение и обрезает файл до size() элементов
+    mmap_vector &operator=(const mmap_vector &v) = delete;
+    mmap_vector &operator=(mmap_vector &&v) noexcept;  // Перегрузка опреатора присваивания
+
+    reference at(size_type pos);                    // Доступ к указанному элементу с проверкой границ
+    const_reference at(size_type pos) const;
+    reference operator[](size_type pos);            // Доступ к указанному элементу
+    const_reference operator[](size_type pos) const;
+    const_reference front() const;                  // Доступ к первому элементу
+    const_reference back() const;                   // Доступ к последнему элементу
+    iterator data();                                // Доступ к отображенному массиву
+    const_iterator data() const;
+
+    iterator begin();  // Возвращает итератор в начало
+    iterator end();    // Возвращает итератор в конец
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    bool empty() const;              // проверка контейнера на пустоту
+    size_type size() const;          // возвращает количество элементов
+    size_type max_size() const;      // возвращает максимально возможное количество элементов
+    void reserve(size_type size);  // удлиняет файл и отображение до size элементов
+    size_type capacity() const;    // возвращает количество элементов в текущем отображении
+    void shrink_to_fit();          // обрезает файл и отображение до size() элементов
+    bool is_read_only() const;     // отображение открыто только для чтения
+
+    void clear();                           // Удаляет элементы, сохраняя емкость
+    void resize(size_type n);               // меняет размер, новые элементы инициализируются нулем
+    void push_back(const_reference value);  // добавляет элемент в конец
+    void pop_back();                        // удаляет последний элемент
+    void swap(mmap_vector &other);          // меняет содержимое
+    void flush();                           // синхронно записывает элементы в файл (msync)
+
+ private:
+    int fd_;
+    mode mode_;
+    size_type size_;
+    size_type capacity_;
+    value_type *arr_;
+    size_type max_size_ = std::numeric_limits<size_t>::max() / sizeof(value_type) / 2;
+
+    void close_file();                 // Снимает отображение и закрывает файл
+    void check_writable() const;       // Бросает std::logic_error для отображения только для чтения
+    void remap_file(size_type n);      // Меняет длину файла и отображения на n элементов
+    size_type increasing_capacity();   // Новая емкость для еще одного элемента (геометрически)
+};
+
+}  // namespace s21
+
+#include "s21_mmap_vector.inl"
+
+#endif  // S21_CONTAINERS_S21_MMAP_VECTOR_HPP
@@ -0,0 +1,273 @@
+#include "s21_mmap_vector.hpp"
+
+namespace s21 {
+
+template <typename T>
+mmap_vector<T>::mmap_vector(const std::string &path, mode m)
+    : fd_(-1), mode_(m), size_(0), capacity_(0), arr_(nullptr) {
+    fd_ = ::open(path.c_str(), m == mode::read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        int error = errno;
+        ::close(fd_);
+        throw std::system_error(error, std::generic_category(), "fstat " + path);
+    }
+    size_type bytes = static_cast<size_type>(st.st_size);
+    if (bytes % sizeof(value_type) != 0) {
+        ::close(fd_);
+        throw std::invalid_argument("The file size is not a multiple of the element size");
+    }
+    if (bytes > 0) {
+        // Файл только для чтения отображается закрыто: запись в элемент не падает на PROT_READ,
+        // а копирует страницу и не меняет файл
+        void *addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                            m == mode::read_only ? MAP_PRIVATE : MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            int error = errno;
+            ::close(fd_);
+            throw std::system_error(error, std::generic_category(), "mmap " + path);
+        }
+        arr_ = static_cast<value_type *>(addr);
+        size_ = capacity_ = bytes / sizeof(value_type);
+    }
+}
+
+template <typename T>
+mmap_vector<T>::mmap_vector(mmap_vector &&v) noexcept
+    : fd_(v.fd_), mode_(v.mode_), size_(v.size_), capacity_(v.capacity_), arr_(v.arr_) {
+    v.fd_ = -1;
+    v.size_ = 0;
+    v.capacity_ = 0;
+    v.arr_ = nullptr;
+}
+
+template <typename T>
+mmap_vector<T>::~mmap_vector() {
+    close_file();
+}
+
+template <typename T>
+mmap_vector<T> &mmap_vector<T>::operator=(mmap_vector &&v) noexcept {
+    if (this != &v) {
+        close_file();
+        swap(v);
+    }
+    return *this;
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("The specified element is outside the bounds of the vector");
+    return *(arr_ + pos);
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("The specified element is outside the bounds of the vector");
+    return *(arr_ + pos);
+}
+
+template <typename T>
+typename mmap_vector<T>::reference mmap_vector<T>::operator[](size_type pos) {
+    return *(arr_ + pos);
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::operator[](size_type pos) const {
+    return *(arr_ + pos);
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::front() const {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return *arr_;
+}
+
+template <typename T>
+typename mmap_vector<T>::const_reference mmap_vector<T>::back() const {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return *(arr_ + size_ - 1);
+}
+
+template <typename T>
+typename mmap_vector<T>::iterator mmap_vector<T>::data() {
+    return arr_;
+}
+
+template <typename T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::data() const {
+    return arr_;
+}
+
+template <typename T>
+typename mmap_vector<T>::iterator mmap_vector<T>::begin() {
+    return arr_;
+}
+
+template <typename T>
+typename mmap_vector<T>::iterator mmap_vector<T>::end() {
+    return arr_ + size_;
+}
+
+template <typename T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::begin() const {
+    return arr_;
+}
+
+template <typename T>
+typename mmap_vector<T>::const_iterator mmap_vector<T>::end() const {
+    return arr_ + size_;
+}
+
+template <typename T>
+bool mmap_vector<T>::empty() const {
+    return size_ == 0;
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::size() const {
+    return size_;
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::max_size() const {
+    return max_size_;
+}
+
+template <typename T>
+void mmap_vector<T>::reserve(size_type size) {
+    if (size > max_size_) throw std::length_error("Vector has exceeded the maximum size values");
+    check_writable();
+    if (size > capacity_) remap_file(size);
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::capacity() const {
+    return capacity_;
+}
+
+template <typename T>
+void mmap_vector<T>::shrink_to_fit() {
+    check_writable();
+    if (capacity_ > size_) remap_file(size_);
+}
+
+template <typename T>
+bool mmap_vector<T>::is_read_only() const {
+    return mode_ == mode::read_only;
+}
+
+template <typename T>
+void mmap_vector<T>::clear() {
+    check_writable();
+    size_ = 0;
+}
+
+template <typename T>
+void mmap_vector<T>::resize(size_type n) {
+    reserve(n);
+    if (n > size_) std::memset(static_cast<void *>(arr_ + size_), 0, (n - size_) * sizeof(value_type));
+    size_ = n;
+}
+
+template <typename T>
+void mmap_vector<T>::push_back(const_reference value) {
+    check_writable();
+    if (size_ == capacity_) {
+        // value может ссылаться на элемент самого вектора, а remap может перенести отображение
+        value_type copy(value);
+        remap_file(increasing_capacity());
+        arr_[size_++] = copy;
+    } else {
+        arr_[size_++] = value;
+    }
+}
+
+template <typename T>
+void mmap_vector<T>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    check_writable();
+    --size_;
+}
+
+template <typename T>
+void mmap_vector<T>::swap(mmap_vector &other) {
+    if (this != &other) {
+        std::swap(fd_, other.fd_);
+        std::swap(mode_, other.mode_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(arr_, other.arr_);
+    }
+}
+
+template <typename T>
+void mmap_vector<T>::flush() {
+    if (mode_ == mode::read_write && size_ > 0 && ::msync(arr_, size_ * sizeof(value_type), MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "msync");
+    }
+}
+
+// private
+
+template <typename T>
+void mmap_vector<T>::close_file() {
+    if (arr_) ::munmap(arr_, capacity_ * sizeof(value_type));
+    if (fd_ >= 0) {
+        // Резерв емкости не должен оставаться в файле: при следующем открытии он стал бы элементами
+        if (mode_ == mode::read_write && capacity_ != size_) {
+            static_cast<void>(::ftruncate(fd_, static_cast<off_t>(size_ * sizeof(value_type))));
+        }
+        ::close(fd_);
+    }
+    fd_ = -1;
+    arr_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+}
+
+template <typename T>
+void mmap_vector<T>::check_writable() const {
+    if (mode_ == mode::read_only) throw std::logic_error("The vector is mapped read-only");
+}
+
+template <typename T>
+void mmap_vector<T>::remap_file(size_type n) {
+    size_type old_bytes = capacity_ * sizeof(value_type);
+    size_type new_bytes = n * sizeof(value_type);
+    if (new_bytes > old_bytes && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+    void *addr = nullptr;
+    if (n == 0) {
+        ::munmap(arr_, old_bytes);
+    } else if (arr_ == nullptr) {
+        addr = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    } else {
+#ifdef MREMAP_MAYMOVE
+        // Ядро переносит таблицы страниц, данные не копируются
+        addr = ::mremap(arr_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+#else
+        addr = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (addr != MAP_FAILED) ::munmap(arr_, old_bytes);
+#endif
+    }
+    if (addr == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "mremap");
+    // Старое отображение уже снято, поэтому члены обновляются до обрезки файла, которая может бросить
+    arr_ = static_cast<value_type *>(addr);
+    capacity_ = n;
+    if (new_bytes < old_bytes && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+}
+
+template <typename T>
+typename mmap_vector<T>::size_type mmap_vector<T>::increasing_capacity() {
+    if (size_ == max_size_) throw std::invalid_argument("Capacity exceeds allowable dimensions");
+    // Отображение выделяется страницами, поэтому меньше страницы емкость не делается
+    size_type page = std::max<size_type>(4096 / sizeof(value_type), 1);
+    return (capacity_ == 0) ? page : std::min(capacity_ * 2, max_size_);
+}
+
+}  // namespace s21
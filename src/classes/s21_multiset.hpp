@@ -1,18 +1,20 @@
 #ifndef S21_CONTAINERS_S21_MULTISET_HPP
 #define S21_CONTAINERS_S21_MULTISET_HPP
 
+#include <cstddef>
 #include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <list>
 #include <utility>
 #include <limits>
-#include <vector>
 
 #include "s21_rbtree.hpp"
 
 namespace s21 {
 
 template <class T>
-class multiset : public RBTree<T, std::vector<T> *> {
+class multiset : public RBTree<T, std::list<T> *> {
  public:
     class MultisetIterator;
 
@@ -23,26 +25,41 @@ class multiset : public RBTree<T, std::vector<T> *> {
     using reference = value_type &;
     using const_reference = const value_type &;
     using iterator = MultisetIterator;
-    using const_iterator = const MultisetIterator;
+    using const_iterator = MultisetIterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     using size_type = size_t;
+    using items_type = std::list<T>;  // Все элементы с ключом узла, в порядке вставки
+    using node_type = RBNode<T, items_type *>;
+    using tree_type = RBTree<T, items_type *>;
 
     // iterator
 
+    // Указывает на элемент списка value_ узла ptr_. Элементы лежат в узлах std::list, поэтому
+    // ссылки на них, как у std::multiset, действуют до удаления самого элемента
     class MultisetIterator {
      public:
-        explicit MultisetIterator(RBNode<T, std::vector<T> *> *ptr,
-                                  RBTree<T, std::vector<T> *> const * ms_ptr,
-                                  int node_pos_ = 0);
-        T operator*() const;
-        void operator++();
-        void operator--();
-        bool operator==(iterator iter2) const;
-        bool operator!=(iterator iter2) const;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit MultisetIterator(node_type *ptr = nullptr, tree_type const * ms_ptr = nullptr);
+        MultisetIterator(node_type *ptr, tree_type const * ms_ptr, typename items_type::iterator item);
+        reference operator*() const;
+        pointer operator->() const;
+        MultisetIterator &operator++();
+        MultisetIterator operator++(int);
+        MultisetIterator &operator--();
+        MultisetIterator operator--(int);
+        bool operator==(const MultisetIterator &iter2) const;
+        bool operator!=(const MultisetIterator &iter2) const;
 
      public:
-        RBNode<T, std::vector<T> *> *ptr_;
-        const RBTree<T, std::vector<T> *> *ms_ptr_;
-        long unsigned int node_pos_;
+        node_type *ptr_;
+        const tree_type *ms_ptr_;
+        typename items_type::iterator item_;  // Действует, только если ptr_ не nullptr
     };
 
     // public methods
@@ -56,6 +73,10 @@ class multiset : public RBTree<T, std::vector<T> *> {
 
     iterator begin() const;
     iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin() const;
+    reverse_iterator rend() const;
 
     bool empty() const;
     size_type size() const;
@@ -5,59 +5,69 @@ namespace s21 {
 // MultisetIterator
 
 template <class T>
-multiset<T>::MultisetIterator::MultisetIterator(RBNode<T, std::vector<T> *> *ptr,
-                                                RBTree<T, std::vector<T> *> const * ms_ptr,
-                                                int node_pos)
-    : ptr_(ptr), ms_ptr_(ms_ptr), node_pos_(node_pos) {
+multiset<T>::MultisetIterator::MultisetIterator(node_type *ptr, tree_type const * ms_ptr)
+    : ptr_(ptr), ms_ptr_(ms_ptr), item_() {
+    if (ptr_) item_ = ptr_->value_->begin();
 }
 
 template <class T>
-T multiset<T>::MultisetIterator::operator*() const {
-    T result = 0;
-    if (ptr_) {
-        if (node_pos_) {
-            result = ptr_->value_->at(node_pos_ - 1);
-        } else {
-            result =  ptr_->key_;
-        }
+multiset<T>::MultisetIterator::MultisetIterator(node_type *ptr, tree_type const * ms_ptr,
+                                                typename items_type::iterator item)
+    : ptr_(ptr), ms_ptr_(ms_ptr), item_(item) {
+}
+
+template <class T>
+typename multiset<T>::MultisetIterator::reference multiset<T>::MultisetIterator::operator*() const {
+    return *item_;
+}
+
+template <class T>
+typename multiset<T>::MultisetIterator::pointer multiset<T>::MultisetIterator::operator->() const {
+    return &**this;
+}
+
+template <class T>
+typename multiset<T>::MultisetIterator &multiset<T>::MultisetIterator::operator++() {
+    if (++item_ == ptr_->value_->end()) {
+        ptr_ = tree_type::next_node(ptr_);
+        if (ptr_) item_ = ptr_->value_->begin();
     }
+    return *this;
+}
+
+template <class T>
+typename multiset<T>::MultisetIterator multiset<T>::MultisetIterator::operator++(int) {
+    MultisetIterator result(*this);
+    ++*this;
     return result;
 }
 
 template <class T>
-void multiset<T>::MultisetIterator::operator++() {
-    if (ptr_) {
-        if (ptr_->value_ && (node_pos_ < ptr_->value_->size())) {
-            ++node_pos_;
-        } else {
-            node_pos_ = 0;
-            ptr_ = ms_ptr_->successor(ptr_->key_);
-        }
+typename multiset<T>::MultisetIterator &multiset<T>::MultisetIterator::operator--() {
+    if (ptr_ && item_ != ptr_->value_->begin()) {
+        --item_;
+    } else {
+        ptr_ = (ptr_) ? tree_type::previous_node(ptr_) : ms_ptr_->max();
+        if (ptr_) item_ = std::prev(ptr_->value_->end());
     }
+    return *this;
 }
 
 template <class T>
-void multiset<T>::MultisetIterator::operator--() {
-    if (ptr_) {
-        if (node_pos_ > 0) {
-            --node_pos_;
-        } else {
-            ptr_ = ms_ptr_->predecessor(ptr_->key_);
-            if (ptr_->value_) {
-                node_pos_ = ptr_->value_->size();
-            }
-        }
-    }
+typename multiset<T>::MultisetIterator multiset<T>::MultisetIterator::operator--(int) {
+    MultisetIterator result(*this);
+    --*this;
+    return result;
 }
 
 template <class T>
-bool multiset<T>::MultisetIterator::operator==(iterator iter2) const {
-    return ((ptr_ == iter2.ptr_) && (node_pos_ == iter2.node_pos_));
+bool multiset<T>::MultisetIterator::operator==(const MultisetIterator &iter2) const {
+    return ((ptr_ == iter2.ptr_) && (!ptr_ || (item_ == iter2.item_)));
 }
 
 template <class T>
-bool multiset<T>::MultisetIterator::operator!=(iterator iter2) const {
-    return ((ptr_ != iter2.ptr_) || (node_pos_ != iter2.node_pos_));
+bool multiset<T>::MultisetIterator::operator!=(const MultisetIterator &iter2) const {
+    return !(*this == iter2);
 }
 
 // set
@@ -74,13 +84,8 @@ multiset<T>::multiset(std::initializer_list<T> const &items) : multiset() {
 
 template <class T>
 multiset<T>::multiset(multiset<T> const &ms) : multiset() {
-    RBNode<T,  std::vector<T> *> *elem = ms.min();
-    while (elem) {
-        insert(elem->key_);
-        for (auto i = elem->value_->begin(); i != elem->value_->end(); ++i) {
-            insert(*i);
-        }
-        elem = ms.successor(elem->key_);
+    for (auto i = ms.begin(); i != ms.end(); ++i) {
+        insert(*i);
     }
 }
 
@@ -115,6 +120,26 @@ typename multiset<T>::iterator multiset<T>::end() const {
     return iterator(nullptr, this);
 }
 
+template <class T>
+typename multiset<T>::const_iterator multiset<T>::cbegin() const {
+    return begin();
+}
+
+template <class T>
+typename multiset<T>::const_iterator multiset<T>::cend() const {
+    return end();
+}
+
+template <class T>
+typename multiset<T>::reverse_iterator multiset<T>::rbegin() const {
+    return reverse_iterator(end());
+}
+
+template <class T>
+typename multiset<T>::reverse_iterator multiset<T>::rend() const {
+    return reverse_iterator(begin());
+}
+
 template <class T>
 bool multiset<T>::empty() const {
     return (size_ == 0);
@@ -132,10 +157,8 @@ typename multiset<T>::size_type multiset<T>::max_size() const {
 
 template <class T>
 void multiset<T>::clear_subnodes() {
-    RBNode<T, std::vector<T> *> *elem = this->min();
-    while (elem) {
+    for (node_type *elem = this->min(); elem; elem = tree_type::next_node(elem)) {
         delete elem->value_;
-        elem = this->successor(elem->key_);
     }
 }
 
@@ -149,28 +172,24 @@ void multiset<T>::clear() {
 
 template <class T>
 typename multiset<T>::iterator multiset<T>::insert(const_reference value) {
-    iterator pos = find(value);
-    if (!pos.ptr_) {
-        std::vector<T> *items = new std::vector<T>;
-        RBNode<T, std::vector<T> *> *node = new RBNode<T, std::vector<T> *>(value, items);
+    // Ключ узла служит только для поиска, сами элементы лежат в списке узла
+    node_type *node = this->lookup(value);
+    if (!node) {
+        node = new node_type(value, new items_type);
         this->insert_node(node);
-        pos = iterator(node, this);
-    } else {
-        pos.ptr_->value_->push_back(value);
-        pos = iterator(pos.ptr_, this, pos.ptr_->value_->size());
     }
+    node->value_->push_back(value);
     ++this->size_;
-    return pos;
+    return iterator(node, this, std::prev(node->value_->end()));
 }
 
 template <class T>
 void multiset<T>::erase(iterator pos) {
-    if (contains(*pos)) {
-        if (pos.ptr_->value_->size() > 0) {
-            pos.ptr_->value_->pop_back();
-        } else {
+    if (pos.ptr_) {
+        pos.ptr_->value_->erase(pos.item_);
+        if (pos.ptr_->value_->empty()) {
             delete pos.ptr_->value_;
-            this->remove(*pos);
+            this->remove(pos.ptr_->key_);
         }
         --size_;
     }
@@ -193,7 +212,7 @@ void multiset<T>::merge(multiset& other) {
 template <class T>
 typename multiset<T>::size_type multiset<T>::count(const_reference key) {
     iterator pos = find(key);
-    return (pos.ptr_) ? 1 + pos.ptr_->value_->size() : 0;
+    return (pos.ptr_) ? pos.ptr_->value_->size() : 0;
 }
 
 template <class T>
@@ -212,9 +231,8 @@ std::pair<typename multiset<T>::iterator, typename multiset<T>::iterator>
         iterator finded = find(key);
         std::pair<iterator, iterator> result = { finded, finded };
         if (finded.ptr_) {
-            result.second = iterator(finded.ptr_, this, finded.ptr_->value_->size());
+            result.second = iterator(tree_type::next_node(finded.ptr_), this);
         }
-        ++result.second;
         return result;
 }
 
@@ -0,0 +1,51 @@
+#ifndef S21_CONTAINERS_S21_PARALLEL_HPP
+#define S21_CONTAINERS_S21_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_thread_pool.hpp"
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Алгоритмы делят vector::data() на непрерывные куски и раздают их потокам пула.
+// Короче parallel_grain элементов вектор обрабатывается в вызывающем потоке
+constexpr size_t parallel_grain = 1 << 14;
+
+template <typename T, class Storage, class Growth, class Compare = std::less<T>>
+void parallel_sort(thread_pool &pool, vector<T, Storage, Growth> &v,
+                   Compare comp = Compare());  // сортирует куски параллельно и сливает их попарно
+template <typename T, class Storage, class Growth, class Function>
+void parallel_for_each(thread_pool &pool, vector<T, Storage, Growth> &v,
+                       Function f);  // вызывает f для каждого элемента
+template <typename T, class StorageIn, class GrowthIn, typename U, class StorageOut, class GrowthOut,
+          class Function>
+void parallel_transform(thread_pool &pool, vector<T, StorageIn, GrowthIn> &in,
+                        vector<U, StorageOut, GrowthOut> &out,
+                        Function f);  // out[i] = f(in[i]), out не короче in
+template <typename T, class Storage, class Growth, class BinaryOp = std::plus<T>>
+T parallel_reduce(thread_pool &pool, vector<T, Storage, Growth> &v, T init,
+                  BinaryOp op = BinaryOp());  // свертка ассоциативной операцией op
+
+// Те же алгоритмы на общем пуле thread_pool::default_pool()
+template <typename T, class Storage, class Growth, class Compare = std::less<T>>
+void parallel_sort(vector<T, Storage, Growth> &v, Compare comp = Compare());
+template <typename T, class Storage, class Growth, class Function>
+void parallel_for_each(vector<T, Storage, Growth> &v, Function f);
+template <typename T, class StorageIn, class GrowthIn, typename U, class StorageOut, class GrowthOut,
+          class Function>
+void parallel_transform(vector<T, StorageIn, GrowthIn> &in, vector<U, StorageOut, GrowthOut> &out,
+                        Function f);
+template <typename T, class Storage, class Growth, class BinaryOp = std::plus<T>>
+T parallel_reduce(vector<T, Storage, Growth> &v, T init, BinaryOp op = BinaryOp());
+
+}  // namespace s21
+
+#include "s21_parallel.inl"
+
+#endif  // S21_CONTAINERS_S21_PARALLEL_HPP
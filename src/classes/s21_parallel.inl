@@ -0,0 +1,120 @@
+#include "s21_parallel.hpp"
+
+namespace s21 {
+
+namespace detail {
+
+// Число кусков для n элементов: не больше 4 на поток, чтобы неравномерная нагрузка
+// выравнивалась, и не меньше parallel_grain элементов в куске
+inline size_t parallel_chunks(thread_pool &pool, size_t n) {
+    size_t by_grain = (n + parallel_grain - 1) / parallel_grain;
+    return std::max<size_t>(std::min(by_grain, pool.size() * 4), 1);
+}
+
+// Границы i-го из chunks кусков диапазона из n элементов
+inline size_t chunk_begin(size_t i, size_t chunks, size_t n) {
+    return n / chunks * i + std::min(i, n % chunks);
+}
+
+}  // namespace detail
+
+template <typename T, class Storage, class Growth, class Compare>
+void parallel_sort(thread_pool &pool, vector<T, Storage, Growth> &v, Compare comp) {
+    T *data = v.data();
+    size_t n = v.size();
+    size_t chunks = std::min((n + parallel_grain - 1) / parallel_grain, pool.size());
+    if (chunks <= 1) {
+        std::sort(data, data + n, comp);
+        return;
+    }
+    pool.parallel_for(chunks, [&](size_t i) {
+        std::sort(data + detail::chunk_begin(i, chunks, n), data + detail::chunk_begin(i + 1, chunks, n),
+                  comp);
+    });
+    // На каждом шаге соседние отсортированные серии ширины width сливаются в серии ширины 2 * width
+    for (size_t width = 1; width < chunks; width *= 2) {
+        size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+        pool.parallel_for(pairs, [&](size_t p) {
+            size_t left = p * 2 * width;
+            size_t middle = std::min(left + width, chunks);
+            size_t right = std::min(left + 2 * width, chunks);
+            if (middle < right) {
+                std::inplace_merge(data + detail::chunk_begin(left, chunks, n),
+                                   data + detail::chunk_begin(middle, chunks, n),
+                                   data + detail::chunk_begin(right, chunks, n), comp);
+            }
+        });
+    }
+}
+
+template <typename T, class Storage, class Growth, class Function>
+void parallel_for_each(thread_pool &pool, vector<T, Storage, Growth> &v, Function f) {
+    T *data = v.data();
+    size_t n = v.size();
+    size_t chunks = detail::parallel_chunks(pool, n);
+    pool.parallel_for(chunks, [&](size_t i) {
+        std::for_each(data + detail::chunk_begin(i, chunks, n), data + detail::chunk_begin(i + 1, chunks, n),
+                      f);
+    });
+}
+
+template <typename T, class StorageIn, class GrowthIn, typename U, class StorageOut, class GrowthOut,
+          class Function>
+void parallel_transform(thread_pool &pool, vector<T, StorageIn, GrowthIn> &in,
+                        vector<U, StorageOut, GrowthOut> &out, Function f) {
+    if (out.size() < in.size()) throw std::out_of_range("The output vector is shorter than the input vector");
+    T *src = in.data();
+    U *dst = out.data();
+    size_t n = in.size();
+    size_t chunks = detail::parallel_chunks(pool, n);
+    pool.parallel_for(chunks, [&](size_t i) {
+        size_t first = detail::chunk_begin(i, chunks, n);
+        std::transform(src + first, src + detail::chunk_begin(i + 1, chunks, n), dst + first, f);
+    });
+}
+
+template <typename T, class Storage, class Growth, class BinaryOp>
+T parallel_reduce(thread_pool &pool, vector<T, Storage, Growth> &v, T init, BinaryOp op) {
+    // Блоки фиксированной длины не зависят от числа потоков, а частичные суммы сворачиваются
+    // слева направо, поэтому результат для float/double одинаков при любом размере пула
+    T *data = v.data();
+    size_t n = v.size();
+    size_t blocks = (n + parallel_grain - 1) / parallel_grain;
+    if (blocks <= 1) return std::accumulate(data, data + n, std::move(init), op);
+    vector<T> partial;
+    partial.insert(partial.begin(), blocks, init);
+    size_t chunks = std::min(blocks, pool.size() * 4);
+    pool.parallel_for(chunks, [&](size_t i) {
+        size_t last_block = detail::chunk_begin(i + 1, chunks, blocks);
+        for (size_t b = detail::chunk_begin(i, chunks, blocks); b < last_block; ++b) {
+            T *first = data + b * parallel_grain;
+            T *last = data + std::min(n, (b + 1) * parallel_grain);
+            partial[b] = std::accumulate(first + 1, last, *first, op);
+        }
+    });
+    return std::accumulate(partial.begin(), partial.end(), std::move(init), op);
+}
+
+template <typename T, class Storage, class Growth, class Compare>
+void parallel_sort(vector<T, Storage, Growth> &v, Compare comp) {
+    parallel_sort(thread_pool::default_pool(), v, comp);
+}
+
+template <typename T, class Storage, class Growth, class Function>
+void parallel_for_each(vector<T, Storage, Growth> &v, Function f) {
+    parallel_for_each(thread_pool::default_pool(), v, f);
+}
+
+template <typename T, class StorageIn, class GrowthIn, typename U, class StorageOut, class GrowthOut,
+          class Function>
+void parallel_transform(vector<T, StorageIn, GrowthIn> &in, vector<U, StorageOut, GrowthOut> &out,
+                        Function f) {
+    parallel_transform(thread_pool::default_pool(), in, out, f);
+}
+
+template <typename T, class Storage, class Growth, class BinaryOp>
+T parallel_reduce(vector<T, Storage, Growth> &v, T init, BinaryOp op) {
+    return parallel_reduce(thread_pool::default_pool(), v, std::move(init), op);
+}
+
+}  // namespace s21
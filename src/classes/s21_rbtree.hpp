@@ -44,6 +44,8 @@ class RBTree {
     RBNode<T, U> * max(RBNode<T, U> *tree = nullptr) const;
     RBNode<T, U> * successor(T key) const;
     RBNode<T, U> * predecessor(T key) const;
+    static RBNode<T, U> * next_node(RBNode<T, U> *node);      // следующий узел по ссылкам parent_, без поиска
+    static RBNode<T, U> * previous_node(RBNode<T, U> *node);  // предыдущий узел по ссылкам parent_
     template <typename V, class W> friend std::ostream& operator<<(std::ostream& out, RBTree<V, W> & tree);
 
  protected:
@@ -297,6 +297,36 @@ RBNode<T, U> * RBTree<T, U>::max(RBNode<T, U> *tree) const {
     return tree;
 }
 
+template <class T, class U>
+RBNode<T, U> * RBTree<T, U>::next_node(RBNode<T, U> *node) {
+    if (node->right_) {
+        node = node->right_;
+        while (node->left_) {
+            node = node->left_;
+        }
+        return node;
+    }
+    while (node->parent_ && node == node->parent_->right_) {
+        node = node->parent_;
+    }
+    return node->parent_;
+}
+
+template <class T, class U>
+RBNode<T, U> * RBTree<T, U>::previous_node(RBNode<T, U> *node) {
+    if (node->left_) {
+        node = node->left_;
+        while (node->right_) {
+            node = node->right_;
+        }
+        return node;
+    }
+    while (node->parent_ && node == node->parent_->left_) {
+        node = node->parent_;
+    }
+    return node->parent_;
+}
+
 template <class T, class U>
 RBNode<T, U> * RBTree<T, U>::successor(T key) const {
     RBNode<T, U> *result = nullptr;
@@ -1,8 +1,10 @@
 #ifndef S21_CONTAINERS_S21_SET_HPP
 #define S21_CONTAINERS_S21_SET_HPP
 
+#include <cstddef>
 #include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <utility>
 #include <limits>
 
@@ -22,19 +24,32 @@ class set : public RBTree<T, int> {
     using reference = value_type &;
     using const_reference = const value_type &;
     using iterator = SetIterator;
-    using const_iterator = const SetIterator;
+    using const_iterator = SetIterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
     using size_type = size_t;
 
     // iterator
 
+    // Ключи множества не изменяются, поэтому итератор возвращает константную ссылку на ключ узла.
+    // Переход к соседнему узлу идет по ссылкам дерева; --end() переходит к наибольшему ключу
     class SetIterator {
      public:
-        explicit SetIterator(RBNode<T, int> * ptr, RBTree<T, int> const * set_ptr);
-        T operator*() const;
-        void operator++();
-        void operator--();
-        bool operator==(iterator iter2) const;
-        bool operator!=(iterator iter2) const;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        explicit SetIterator(RBNode<T, int> * ptr = nullptr, RBTree<T, int> const * set_ptr = nullptr);
+        reference operator*() const;
+        pointer operator->() const;
+        SetIterator &operator++();
+        SetIterator operator++(int);
+        SetIterator &operator--();
+        SetIterator operator--(int);
+        bool operator==(const SetIterator &iter2) const;
+        bool operator!=(const SetIterator &iter2) const;
 
      public:
         RBNode<T, int> *ptr_;
@@ -52,6 +67,10 @@ class set : public RBTree<T, int> {
 
     iterator begin() const;
     iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin() const;
+    reverse_iterator rend() const;
 
     bool empty() const;
     size_type size() const;
@@ -9,27 +9,48 @@ set<T>::SetIterator::SetIterator(RBNode<T, int> * ptr, RBTree<T, int> const * se
     : ptr_(ptr), set_ptr_(set_ptr) {}
 
 template <class T>
-T set<T>::SetIterator::operator*() const {
-    return (ptr_) ? ptr_->key_ : 0;
+typename set<T>::SetIterator::reference set<T>::SetIterator::operator*() const {
+    return ptr_->key_;
 }
 
 template <class T>
-void set<T>::SetIterator::operator++() {
-    ptr_ = (ptr_) ? set_ptr_->successor(ptr_->key_) : nullptr;
+typename set<T>::SetIterator::pointer set<T>::SetIterator::operator->() const {
+    return &ptr_->key_;
 }
 
 template <class T>
-void set<T>::SetIterator::operator--() {
-    ptr_ = (ptr_) ? set_ptr_->predecessor(ptr_->key_) : nullptr;
+typename set<T>::SetIterator &set<T>::SetIterator::operator++() {
+    ptr_ = RBTree<T, int>::next_node(ptr_);
+    return *this;
+}
+
+template <class T>
+typename set<T>::SetIterator set<T>::SetIterator::operator++(int) {
+    SetIterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class T>
+typename set<T>::SetIterator &set<T>::SetIterator::operator--() {
+    ptr_ = (ptr_) ? RBTree<T, int>::previous_node(ptr_) : set_ptr_->max();
+    return *this;
+}
+
+template <class T>
+typename set<T>::SetIterator set<T>::SetIterator::operator--(int) {
+    SetIterator result(*this);
+    --*this;
+    return result;
 }
 
 template <class T>
-bool set<T>::SetIterator::operator==(iterator iter2) const {
+bool set<T>::SetIterator::operator==(const SetIterator &iter2) const {
     return (ptr_ == iter2.ptr_);
 }
 
 template <class T>
-bool set<T>::SetIterator::operator!=(iterator iter2) const {
+bool set<T>::SetIterator::operator!=(const SetIterator &iter2) const {
     return (ptr_ != iter2.ptr_);
 }
 
@@ -84,6 +105,26 @@ typename set<T>::iterator set<T>::end() const {
     return iterator(nullptr, this);
 }
 
+template <class T>
+typename set<T>::const_iterator set<T>::cbegin() const {
+    return begin();
+}
+
+template <class T>
+typename set<T>::const_iterator set<T>::cend() const {
+    return end();
+}
+
+template <class T>
+typename set<T>::reverse_iterator set<T>::rbegin() const {
+    return reverse_iterator(end());
+}
+
+template <class T>
+typename set<T>::reverse_iterator set<T>::rend() const {
+    return reverse_iterator(begin());
+}
+
 template <class T>
 bool set<T>::empty() const {
     return (size_ == 0);
@@ -121,7 +162,7 @@ std::pair<typename set<T>::iterator, bool> set<T>::insert(const_reference value)
 
 template <class T>
 void set<T>::erase(iterator pos) {
-    if (contains(*pos)) {
+    if (pos.ptr_ && contains(*pos)) {
         this->remove(*pos);
         --size_;
     }
@@ -0,0 +1,80 @@
+#ifndef S21_CONTAINERS_S21_SIMD_HPP
+#define S21_CONTAINERS_S21_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_vector.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace simd {
+
+// Набор инструкций, которым выполняются ядра. SSE2/AVX2 используются для int32_t, float и double,
+// остальные арифметические типы всегда обрабатываются скалярным циклом
+enum class isa {
+    scalar,
+    sse2,
+    avx2,
+};
+
+template <typename T>
+struct identity {
+    using type = T;
+};
+
+// Тип результата sum(): int32_t суммируется в 64 битах, остальные типы в самих себе
+template <typename T>
+using sum_type = std::conditional_t<std::is_integral<T>::value && sizeof(T) < sizeof(int64_t),
+                                    std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>, T>;
+
+inline isa supported_isa();        // лучший набор инструкций, доступный процессору
+inline isa active_isa();           // набор инструкций, выбранный для ядер
+inline void force_isa(isa value);  // выбирает набор инструкций (не выше supported_isa())
+
+// Ядра над диапазоном [first, last). min/max требуют непустой диапазон; для float/double
+// результат на диапазонах с NaN не определен, а порядок суммирования зависит от набора инструкций
+template <typename T>
+const T *find(const T *first, const T *last, typename identity<T>::type value);
+template <typename T>
+size_t count(const T *first, const T *last, typename identity<T>::type value);
+template <typename T>
+T min(const T *first, const T *last);
+template <typename T>
+T max(const T *first, const T *last);
+template <typename T>
+sum_type<T> sum(const T *first, const T *last);
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2);
+inline size_t popcount(const uint64_t *first,
+                       const uint64_t *last);  // число единичных бит, инструкцией popcnt при поддержке
+
+// Те же ядра над s21::vector
+template <typename T, class Storage, class Growth>
+typename vector<T, Storage, Growth>::iterator find(vector<T, Storage, Growth> &v,
+                                                  typename identity<T>::type value);
+template <typename T, class Storage, class Growth>
+size_t count(vector<T, Storage, Growth> &v, typename identity<T>::type value);
+template <typename T, class Storage, class Growth>
+T min(vector<T, Storage, Growth> &v);
+template <typename T, class Storage, class Growth>
+T max(vector<T, Storage, Growth> &v);
+template <typename T, class Storage, class Growth>
+sum_type<T> sum(vector<T, Storage, Growth> &v);
+template <typename T, class Storage, class Growth>
+bool equal(vector<T, Storage, Growth> &v1, vector<T, Storage, Growth> &v2);
+
+}  // namespace simd
+}  // namespace s21
+
+#include "s21_simd.inl"
+
+#endif  // S21_CONTAINERS_S21_SIMD_HPP
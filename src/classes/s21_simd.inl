@@ -0,0 +1,519 @@
+#include "s21_simd.hpp"
+
+#if S21_SIMD_X86
+#define S21_SIMD_AVX2 __attribute__((target("avx2")))
+#endif
+#define S21_SIMD_KERNEL inline __attribute__((always_inline))
+
+namespace s21 {
+namespace simd {
+namespace detail {
+
+template <typename T>
+constexpr bool has_kernels =
+    std::is_same<T, int32_t>::value || std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+// Скалярные ядра: запасной путь и обработка хвостов
+
+template <typename T>
+const T *scalar_find(const T *first, const T *last, T value) {
+    for (; first != last; ++first) {
+        if (*first == value) break;
+    }
+    return first;
+}
+
+template <typename T>
+size_t scalar_count(const T *first, const T *last, T value) {
+    size_t result = 0;
+    for (; first != last; ++first) {
+        result += (*first == value);
+    }
+    return result;
+}
+
+template <typename T>
+T scalar_min(const T *first, const T *last, T result) {
+    for (; first != last; ++first) {
+        if (*first < result) result = *first;
+    }
+    return result;
+}
+
+template <typename T>
+T scalar_max(const T *first, const T *last, T result) {
+    for (; first != last; ++first) {
+        if (result < *first) result = *first;
+    }
+    return result;
+}
+
+template <typename T>
+sum_type<T> scalar_sum(const T *first, const T *last) {
+    sum_type<T> result = 0;
+    for (; first != last; ++first) {
+        result += *first;
+    }
+    return result;
+}
+
+template <typename T>
+bool scalar_equal(const T *first1, const T *last1, const T *first2) {
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2)) return false;
+    }
+    return true;
+}
+
+// Подсчет бит сложением по полям без инструкции popcnt
+inline size_t scalar_popcount(const uint64_t *first, const uint64_t *last) {
+    size_t result = 0;
+    for (; first != last; ++first) {
+        uint64_t x = *first;
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        result += (x * 0x0101010101010101ull) >> 56;
+    }
+    return result;
+}
+
+// Векторные ядра, общие для всех наборов инструкций. Ops описывает регистр и операции над ним:
+// width элементов в регистре, eq_mask возвращает по биту на совпавший элемент. Ядра всегда
+// встраиваются в точку входа с нужным target, поэтому предупреждение о смене ABI к ним не относится
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL const T *find_kernel(const T *first, const T *last, T value) {
+    auto needle = Ops::set1(value);
+    for (; last - first >= Ops::width; first += Ops::width) {
+        unsigned mask = Ops::eq_mask(Ops::load(first), needle);
+        if (mask) return first + __builtin_ctz(mask);
+    }
+    return scalar_find(first, last, value);
+}
+
+// Число единиц в маске из eq_mask (не более 8 бит). Таблица вместо __builtin_popcount,
+// который без -mpopcnt превращается в вызов библиотечной функции
+inline unsigned mask_popcount(unsigned mask) {
+    static constexpr unsigned char bits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+    return bits[mask & 0xF] + bits[mask >> 4];
+}
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL size_t count_kernel(const T *first, const T *last, T value) {
+    auto needle = Ops::set1(value);
+    size_t result = 0;
+    for (; last - first >= Ops::width; first += Ops::width) {
+        result += mask_popcount(Ops::eq_mask(Ops::load(first), needle));
+    }
+    return result + scalar_count(first, last, value);
+}
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL T min_kernel(const T *first, const T *last) {
+    if (last - first < Ops::width) return scalar_min(first + 1, last, *first);
+    auto result = Ops::load(first);
+    for (first += Ops::width; last - first >= Ops::width; first += Ops::width) {
+        result = Ops::vmin(result, Ops::load(first));
+    }
+    T lanes[Ops::width];
+    Ops::store(lanes, result);
+    return scalar_min(first, last, scalar_min(lanes + 1, lanes + Ops::width, lanes[0]));
+}
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL T max_kernel(const T *first, const T *last) {
+    if (last - first < Ops::width) return scalar_max(first + 1, last, *first);
+    auto result = Ops::load(first);
+    for (first += Ops::width; last - first >= Ops::width; first += Ops::width) {
+        result = Ops::vmax(result, Ops::load(first));
+    }
+    T lanes[Ops::width];
+    Ops::store(lanes, result);
+    return scalar_max(first, last, scalar_max(lanes + 1, lanes + Ops::width, lanes[0]));
+}
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL sum_type<T> sum_kernel(const T *first, const T *last) {
+    auto result = Ops::acc_zero();
+    for (; last - first >= Ops::width; first += Ops::width) {
+        result = Ops::acc_add(result, Ops::load(first));
+    }
+    return Ops::acc_reduce(result) + scalar_sum(first, last);
+}
+
+template <class Ops, typename T>
+S21_SIMD_KERNEL bool equal_kernel(const T *first1, const T *last1, const T *first2) {
+    for (; last1 - first1 >= Ops::width; first1 += Ops::width, first2 += Ops::width) {
+        if (Ops::eq_mask(Ops::load(first1), Ops::load(first2)) != Ops::full_mask) return false;
+    }
+    return scalar_equal(first1, last1, first2);
+}
+
+#pragma GCC diagnostic pop
+
+#if S21_SIMD_X86
+
+// SSE2
+
+template <typename T>
+struct sse2_ops;
+
+template <>
+struct sse2_ops<int32_t> {
+    using reg = __m128i;
+    static constexpr std::ptrdiff_t width = 4;
+    static constexpr unsigned full_mask = 0xF;
+    static reg load(const int32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    static void store(int32_t *p, reg a) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a); }
+    static reg set1(int32_t value) { return _mm_set1_epi32(value); }
+    static unsigned eq_mask(reg a, reg b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static reg vmin(reg a, reg b) {
+        reg gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+    static reg vmax(reg a, reg b) {
+        reg gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+    // Сумма копится в двух 64-битных дорожках, чтобы не переполниться
+    static reg acc_zero() { return _mm_setzero_si128(); }
+    static reg acc_add(reg acc, reg a) {
+        reg sign = _mm_srai_epi32(a, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(a, sign));
+        return _mm_add_epi64(acc, _mm_unpackhi_epi32(a, sign));
+    }
+    static int64_t acc_reduce(reg acc) {
+        int64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+        return lanes[0] + lanes[1];
+    }
+};
+
+template <>
+struct sse2_ops<float> {
+    using reg = __m128;
+    static constexpr std::ptrdiff_t width = 4;
+    static constexpr unsigned full_mask = 0xF;
+    static reg load(const float *p) { return _mm_loadu_ps(p); }
+    static void store(float *p, reg a) { _mm_storeu_ps(p, a); }
+    static reg set1(float value) { return _mm_set1_ps(value); }
+    static unsigned eq_mask(reg a, reg b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static reg vmin(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg vmax(reg a, reg b) { return _mm_max_ps(a, b); }
+    static reg acc_zero() { return _mm_setzero_ps(); }
+    static reg acc_add(reg acc, reg a) { return _mm_add_ps(acc, a); }
+    static float acc_reduce(reg acc) {
+        float lanes[4];
+        _mm_storeu_ps(lanes, acc);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <>
+struct sse2_ops<double> {
+    using reg = __m128d;
+    static constexpr std::ptrdiff_t width = 2;
+    static constexpr unsigned full_mask = 0x3;
+    static reg load(const double *p) { return _mm_loadu_pd(p); }
+    static void store(double *p, reg a) { _mm_storeu_pd(p, a); }
+    static reg set1(double value) { return _mm_set1_pd(value); }
+    static unsigned eq_mask(reg a, reg b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static reg vmin(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg vmax(reg a, reg b) { return _mm_max_pd(a, b); }
+    static reg acc_zero() { return _mm_setzero_pd(); }
+    static reg acc_add(reg acc, reg a) { return _mm_add_pd(acc, a); }
+    static double acc_reduce(reg acc) {
+        double lanes[2];
+        _mm_storeu_pd(lanes, acc);
+        return lanes[0] + lanes[1];
+    }
+};
+
+// AVX2
+
+template <typename T>
+struct avx2_ops;
+
+template <>
+struct avx2_ops<int32_t> {
+    using reg = __m256i;
+    static constexpr std::ptrdiff_t width = 8;
+    static constexpr unsigned full_mask = 0xFF;
+    S21_SIMD_AVX2 static reg load(const int32_t *p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+    S21_SIMD_AVX2 static void store(int32_t *p, reg a) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), a);
+    }
+    S21_SIMD_AVX2 static reg set1(int32_t value) { return _mm256_set1_epi32(value); }
+    S21_SIMD_AVX2 static unsigned eq_mask(reg a, reg b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+    }
+    S21_SIMD_AVX2 static reg vmin(reg a, reg b) { return _mm256_min_epi32(a, b); }
+    S21_SIMD_AVX2 static reg vmax(reg a, reg b) { return _mm256_max_epi32(a, b); }
+    // Сумма копится в четырех 64-битных дорожках, чтобы не переполниться
+    S21_SIMD_AVX2 static reg acc_zero() { return _mm256_setzero_si256(); }
+    S21_SIMD_AVX2 static reg acc_add(reg acc, reg a) {
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a)));
+        return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1)));
+    }
+    S21_SIMD_AVX2 static int64_t acc_reduce(reg acc) {
+        int64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template <>
+struct avx2_ops<float> {
+    using reg = __m256;
+    static constexpr std::ptrdiff_t width = 8;
+    static constexpr unsigned full_mask = 0xFF;
+    S21_SIMD_AVX2 static reg load(const float *p) { return _mm256_loadu_ps(p); }
+    S21_SIMD_AVX2 static void store(float *p, reg a) { _mm256_storeu_ps(p, a); }
+    S21_SIMD_AVX2 static reg set1(float value) { return _mm256_set1_ps(value); }
+    S21_SIMD_AVX2 static unsigned eq_mask(reg a, reg b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    }
+    S21_SIMD_AVX2 static reg vmin(reg a, reg b) { return _mm256_min_ps(a, b); }
+    S21_SIMD_AVX2 static reg vmax(reg a, reg b) { return _mm256_max_ps(a, b); }
+    S21_SIMD_AVX2 static reg acc_zero() { return _mm256_setzero_ps(); }
+    S21_SIMD_AVX2 static reg acc_add(reg acc, reg a) { return _mm256_add_ps(acc, a); }
+    S21_SIMD_AVX2 static float acc_reduce(reg acc) {
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc);
+        float low = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        return low + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+};
+
+template <>
+struct avx2_ops<double> {
+    using reg = __m256d;
+    static constexpr std::ptrdiff_t width = 4;
+    static constexpr unsigned full_mask = 0xF;
+    S21_SIMD_AVX2 static reg load(const double *p) { return _mm256_loadu_pd(p); }
+    S21_SIMD_AVX2 static void store(double *p, reg a) { _mm256_storeu_pd(p, a); }
+    S21_SIMD_AVX2 static reg set1(double value) { return _mm256_set1_pd(value); }
+    S21_SIMD_AVX2 static unsigned eq_mask(reg a, reg b) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    }
+    S21_SIMD_AVX2 static reg vmin(reg a, reg b) { return _mm256_min_pd(a, b); }
+    S21_SIMD_AVX2 static reg vmax(reg a, reg b) { return _mm256_max_pd(a, b); }
+    S21_SIMD_AVX2 static reg acc_zero() { return _mm256_setzero_pd(); }
+    S21_SIMD_AVX2 static reg acc_add(reg acc, reg a) { return _mm256_add_pd(acc, a); }
+    S21_SIMD_AVX2 static double acc_reduce(reg acc) {
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+// Точки входа наборов инструкций. AVX2-версии компилируются с target("avx2") и вызываются
+// только после проверки процессора, поэтому остальной код собирается без -mavx2
+
+template <typename T>
+const T *sse2_find(const T *first, const T *last, T value) {
+    return find_kernel<sse2_ops<T>>(first, last, value);
+}
+
+template <typename T>
+size_t sse2_count(const T *first, const T *last, T value) {
+    return count_kernel<sse2_ops<T>>(first, last, value);
+}
+
+template <typename T>
+T sse2_min(const T *first, const T *last) {
+    return min_kernel<sse2_ops<T>>(first, last);
+}
+
+template <typename T>
+T sse2_max(const T *first, const T *last) {
+    return max_kernel<sse2_ops<T>>(first, last);
+}
+
+template <typename T>
+sum_type<T> sse2_sum(const T *first, const T *last) {
+    return sum_kernel<sse2_ops<T>>(first, last);
+}
+
+template <typename T>
+bool sse2_equal(const T *first1, const T *last1, const T *first2) {
+    return equal_kernel<sse2_ops<T>>(first1, last1, first2);
+}
+
+template <typename T>
+S21_SIMD_AVX2 const T *avx2_find(const T *first, const T *last, T value) {
+    return find_kernel<avx2_ops<T>>(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_AVX2 size_t avx2_count(const T *first, const T *last, T value) {
+    return count_kernel<avx2_ops<T>>(first, last, value);
+}
+
+template <typename T>
+S21_SIMD_AVX2 T avx2_min(const T *first, const T *last) {
+    return min_kernel<avx2_ops<T>>(first, last);
+}
+
+template <typename T>
+S21_SIMD_AVX2 T avx2_max(const T *first, const T *last) {
+    return max_kernel<avx2_ops<T>>(first, last);
+}
+
+template <typename T>
+S21_SIMD_AVX2 sum_type<T> avx2_sum(const T *first, const T *last) {
+    return sum_kernel<avx2_ops<T>>(first, last);
+}
+
+template <typename T>
+S21_SIMD_AVX2 bool avx2_equal(const T *first1, const T *last1, const T *first2) {
+    return equal_kernel<avx2_ops<T>>(first1, last1, first2);
+}
+
+// popcnt не входит в SSE2 и проверяется отдельно. Четыре независимых суммы не дают
+// конвейеру ждать результата предыдущей инструкции
+
+inline bool has_popcnt() {
+    static const bool value = __builtin_cpu_supports("popcnt");
+    return value;
+}
+
+__attribute__((target("popcnt"))) inline size_t popcnt_popcount(const uint64_t *first, const uint64_t *last) {
+    size_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    for (; last - first >= 4; first += 4) {
+        sum0 += __builtin_popcountll(first[0]);
+        sum1 += __builtin_popcountll(first[1]);
+        sum2 += __builtin_popcountll(first[2]);
+        sum3 += __builtin_popcountll(first[3]);
+    }
+    for (; first != last; ++first) sum0 += __builtin_popcountll(*first);
+    return sum0 + sum1 + sum2 + sum3;
+}
+
+#endif  // S21_SIMD_X86
+
+inline isa &selected_isa() {
+    static isa value = supported_isa();
+    return value;
+}
+
+}  // namespace detail
+
+inline isa supported_isa() {
+#if S21_SIMD_X86
+    static const isa value = __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+    return value;
+#else
+    return isa::scalar;
+#endif
+}
+
+inline isa active_isa() {
+    return detail::selected_isa();
+}
+
+inline void force_isa(isa value) {
+    detail::selected_isa() = (value > supported_isa()) ? supported_isa() : value;
+}
+
+#if S21_SIMD_X86
+#define S21_SIMD_DISPATCH(kernel, ...)                                               \
+    if constexpr (detail::has_kernels<T>) {                                         \
+        if (active_isa() == isa::avx2) return detail::avx2_##kernel(__VA_ARGS__);   \
+        if (active_isa() == isa::sse2) return detail::sse2_##kernel(__VA_ARGS__);   \
+    }
+#else
+#define S21_SIMD_DISPATCH(kernel, ...)
+#endif
+
+template <typename T>
+const T *find(const T *first, const T *last, typename identity<T>::type value) {
+    S21_SIMD_DISPATCH(find, first, last, value)
+    return detail::scalar_find(first, last, value);
+}
+
+template <typename T>
+size_t count(const T *first, const T *last, typename identity<T>::type value) {
+    S21_SIMD_DISPATCH(count, first, last, value)
+    return detail::scalar_count(first, last, value);
+}
+
+template <typename T>
+T min(const T *first, const T *last) {
+    S21_SIMD_DISPATCH(min, first, last)
+    return detail::scalar_min(first + 1, last, *first);
+}
+
+template <typename T>
+T max(const T *first, const T *last) {
+    S21_SIMD_DISPATCH(max, first, last)
+    return detail::scalar_max(first + 1, last, *first);
+}
+
+template <typename T>
+sum_type<T> sum(const T *first, const T *last) {
+    S21_SIMD_DISPATCH(sum, first, last)
+    return detail::scalar_sum(first, last);
+}
+
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+    S21_SIMD_DISPATCH(equal, first1, last1, first2)
+    return detail::scalar_equal(first1, last1, first2);
+}
+
+#undef S21_SIMD_DISPATCH
+
+inline size_t popcount(const uint64_t *first, const uint64_t *last) {
+#if S21_SIMD_X86
+    if (active_isa() != isa::scalar && detail::has_popcnt()) return detail::popcnt_popcount(first, last);
+#endif
+    return detail::scalar_popcount(first, last);
+}
+
+template <typename T, class Storage, class Growth>
+typename vector<T, Storage, Growth>::iterator find(vector<T, Storage, Growth> &v,
+                                                  typename identity<T>::type value) {
+    return const_cast<T *>(find<T>(v.begin(), v.end(), value));
+}
+
+template <typename T, class Storage, class Growth>
+size_t count(vector<T, Storage, Growth> &v, typename identity<T>::type value) {
+    return count<T>(v.begin(), v.end(), value);
+}
+
+template <typename T, class Storage, class Growth>
+T min(vector<T, Storage, Growth> &v) {
+    if (v.empty()) throw std::out_of_range("The vector contains no elements");
+    return min<T>(v.begin(), v.end());
+}
+
+template <typename T, class Storage, class Growth>
+T max(vector<T, Storage, Growth> &v) {
+    if (v.empty()) throw std::out_of_range("The vector contains no elements");
+    return max<T>(v.begin(), v.end());
+}
+
+template <typename T, class Storage, class Growth>
+sum_type<T> sum(vector<T, Storage, Growth> &v) {
+    return sum<T>(v.begin(), v.end());
+}
+
+template <typename T, class Storage, class Growth>
+bool equal(vector<T, Storage, Growth> &v1, vector<T, Storage, Growth> &v2) {
+    return v1.size() == v2.size() && equal<T>(v1.begin(), v1.end(), v2.begin());
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#if S21_SIMD_X86
+#undef S21_SIMD_AVX2
+#endif
+#undef S21_SIMD_KERNEL
@@ -0,0 +1,113 @@
+#ifndef S21_CONTAINERS_S21_SMALL_VECTOR_HPP
+#define S21_CONTAINERS_S21_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector_relocation.hpp"
+#include "s21_vector_storage.hpp"
+
+namespace s21 {
+
+// Вектор, хранящий до N элементов во встроенном буфере и переходящий в кучу только при росте сверх N
+template <typename T, std::size_t N>
+class small_vector {
+ public:
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using size_type = size_t;
+
+    small_vector();                      // Конструктор по умолчанию
+    explicit small_vector(size_type n);  // Конструктор размера n
+    explicit small_vector(std::initializer_list<value_type> const
+                              &items);  // Конструктор инициализированный с помощью std::initializer_list
+    small_vector(const small_vector &v);  // Конструктор копирования
+    small_vector(small_vector &&v) noexcept(
+        std::is_nothrow_move_constructible<value_type>::value);  // Конструктор перемещения
+    ~small_vector();                                             // Деструктор
+    small_vector &operator=(small_vector &&v) noexcept(
+        std::is_nothrow_move_constructible<value_type>::value);  // Перегрузка опреатора присваивания
+    small_vector &operator=(const small_vector &v);              // Перегрузка опреатора присваивания
+
+    reference at(size_type pos);  // Доступ к указанному элементу с проверкой границ
+    reference operator[](size_type pos);  // Доступ к указанному элементу
+    const_reference front();              // Доступ к первому элементу
+    const_reference back();               // Доступ к последнему элементу
+    iterator data();                      // Доступ к базовому массиву
+
+    iterator begin();  // Возвращает итератор в начало
+    iterator end();    // Возвращает итератор в конец
+
+    bool empty();          // проверка контейнера на пустоту
+    size_type size();      // возвращает количество элементов
+    size_type max_size();  // возвращает максимально возможное количество элементов
+    void reserve(size_type size);  // выделяет хранилище не меньше size элементов
+    size_type capacity();  // возвращает количество элементов, которые помещаются в текущее хранилище
+    void shrink_to_fit();  // возвращает элементы во встроенный буфер или ужимает кучу до size()
+    bool is_inline();      // элементы хранятся во встроенном буфере
+
+    void clear();  // Очищает содержимое, сохраняя емкость
+    iterator insert(iterator pos, const_reference value);  // вставляет value перед pos
+    iterator insert(iterator pos, size_type count,
+                    const_reference value);  // вставляет count копий value перед pos
+    template <class ForwardIt,
+              typename = std::enable_if_t<!std::is_integral<ForwardIt>::value>>
+    iterator insert(iterator pos, ForwardIt first,
+                    ForwardIt last);  // вставляет диапазон [first, last) перед pos
+    void erase(iterator pos);         // стирает элемент в позиции
+    iterator erase(iterator first, iterator last);  // стирает диапазон [first, last)
+    template <class Predicate>
+    size_type erase_if(Predicate pred);  // удаляет элементы, для которых pred истинен, за один проход
+    void push_back(const_reference value);  // добавляет элемент в конец
+    void push_back(value_type &&value);     // перемещает элемент в конец
+    void pop_back();                        // удаляет последний элемент
+    void swap(small_vector &other);         // меняет содержимое
+
+    template <class... Args>
+    iterator emplace(const_iterator pos,
+                     Args &&...args);  // создает элемент из args непосредственно перед pos
+    template <class... Args>
+    reference emplace_back(Args &&...args);  // создает элемент из args в конце контейнера
+
+ private:
+    static constexpr size_type inline_capacity_ = N;
+    static constexpr bool is_trivially_copyable_ =
+        std::is_trivially_copyable<value_type>::value;  // Элементы переносятся memcpy/memmove
+
+    size_type size_;
+    size_type capacity_;
+    value_type *arr_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type) * (N ? N : 1)];
+    size_type max_size_ = std::numeric_limits<size_t>::max() / sizeof(value_type) / 2;
+
+    value_type *inline_data();                       // Начало встроенного буфера
+    void destroy_elements(size_type first);          // Разрушает элементы [first, size_)
+    static value_type *allocate_heap(size_type n);   // Память кучи под n элементов с выравниванием T
+    static void release_heap(value_type *buff, size_type n);  // Освобождает память allocate_heap(n)
+    void release_storage();                          // Освобождает кучу и возвращается к буферу
+    void take_elements(small_vector &v);             // Забирает элементы v, оставляя его пустым
+    size_type increasing_capacity(size_type count = 1);  // Новая емкость для еще count элементов
+    void resize_storage(size_type n);                // Переносит элементы в хранилище емкости n
+    // Переносит элементы в buff, оставляя count слотов с gap; filled - слоты уже заняты созданными
+    // элементами, которые при исключении разрушаются вместе с buff
+    void move_elements(value_type *buff, size_type n, size_type gap, size_type count, bool filled = false);
+    void shift_elements(size_type index, size_type count);  // Сдвигает хвост с index на count вправо
+    void open_gap(size_type index, size_type count);  // Освобождает count слотов с index
+};
+
+}  // namespace s21
+
+#include "s21_small_vector.inl"
+
+#endif  // S21_CONTAINERS_S21_SMALL_VECTOR_HPP
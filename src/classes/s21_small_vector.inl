@@ -0,0 +1,383 @@
+#include "s21_small_vector.hpp"
+
+namespace s21 {
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector() : size_(0), capacity_(N), arr_(inline_data()) {}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+    reserve(n);
+    for (; size_ < n; ++size_) {
+        new (arr_ + size_) value_type();
+    }
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(std::initializer_list<value_type> const &items) : small_vector() {
+    insert(begin(), items.begin(), items.end());
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(const small_vector &v) : small_vector() {
+    *this = v;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value)
+    : small_vector() {
+    take_elements(v);
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::~small_vector() {
+    destroy_elements(0);
+    release_storage();
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<value_type>::value) {
+    if (this != &v) {
+        destroy_elements(0);
+        release_storage();
+        take_elements(v);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &v) {
+    if (this != &v) {
+        clear();
+        reserve(v.size_);
+        if constexpr (is_trivially_copyable_) {
+            if (v.size_) std::memcpy(arr_, v.arr_, v.size_ * sizeof(value_type));
+            size_ = v.size_;
+        } else {
+            for (; size_ < v.size_; ++size_) {
+                new (arr_ + size_) value_type(v.arr_[size_]);
+            }
+        }
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("The specified element is outside the bounds of the vector");
+    return *(arr_ + pos);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::operator[](size_type pos) {
+    return *(arr_ + pos);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::front() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return *arr_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return *(arr_ + size_ - 1);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::data() {
+    return arr_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::begin() {
+    return arr_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::end() {
+    return arr_ + size_;
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::empty() {
+    return size_ == 0;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::size() {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::max_size() {
+    return max_size_;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+    if (size > max_size_) throw std::length_error("Vector has exceeded the maximum size values");
+    if (size > capacity_) resize_storage(size);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::capacity() {
+    return capacity_;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+    if (!is_inline() && capacity_ > size_) resize_storage(size_);
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::is_inline() {
+    return arr_ == inline_data();
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::clear() {
+    destroy_elements(0);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(iterator pos, size_type count,
+                                                                 const_reference value) {
+    size_type index = pos - arr_;
+    if (count > 0) {
+        value_type copy(value);
+        open_gap(index, count);
+        detail::fill_gap(arr_, index, size_, count,
+                         [&copy](value_type *slot) { new (slot) value_type(copy); });
+        size_ += count;
+    }
+    return arr_ + index;
+}
+
+template <typename T, std::size_t N>
+template <class ForwardIt, typename>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(iterator pos, ForwardIt first,
+                                                                 ForwardIt last) {
+    size_type index = pos - arr_;
+    size_type count = std::distance(first, last);
+    if (count > 0) {
+        open_gap(index, count);
+        detail::fill_gap(arr_, index, size_, count,
+                         [&first](value_type *slot) { new (slot) value_type(*first++); });
+        size_ += count;
+    }
+    return arr_ + index;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::erase(iterator pos) {
+    if (pos != end()) erase(pos, pos + 1);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::erase(iterator first, iterator last) {
+    size_type index = first - arr_;
+    size_type count = last - first;
+    if (count > 0) {
+        if constexpr (is_trivially_copyable_) {
+            std::memmove(first, last, (end() - last) * sizeof(value_type));
+        } else {
+            for (; last != end(); ++first, ++last) {
+                *first = std::move(*last);
+            }
+        }
+        destroy_elements(size_ - count);
+    }
+    return arr_ + index;
+}
+
+template <typename T, std::size_t N>
+template <class Predicate>
+typename small_vector<T, N>::size_type small_vector<T, N>::erase_if(Predicate pred) {
+    size_type kept = 0;
+    for (size_type i = 0; i < size_; ++i) {
+        if (!pred(arr_[i])) {
+            if (kept != i) arr_[kept] = std::move(arr_[i]);
+            ++kept;
+        }
+    }
+    size_type removed = size_ - kept;
+    destroy_elements(kept);
+    return removed;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(value_type &&value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    destroy_elements(size_ - 1);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::swap(small_vector &other) {
+    if (this != &other) {
+        if (!is_inline() && !other.is_inline()) {
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(arr_, other.arr_);
+        } else {
+            small_vector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+    }
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace(const_iterator pos, Args &&...args) {
+    size_type index = pos - arr_;
+    if (size_ == capacity_) {
+        // Новый элемент создается в новом хранилище до переноса старых, поэтому args
+        // могут ссылаться на элементы самого вектора
+        size_type n = increasing_capacity();
+        value_type *buff = allocate_heap(n);
+        try {
+            new (buff + index) value_type(std::forward<Args>(args)...);
+        } catch (...) {
+            release_heap(buff, n);
+            throw;
+        }
+        move_elements(buff, n, index, 1, true);
+    } else if (index == size_) {
+        new (arr_ + size_) value_type(std::forward<Args>(args)...);
+    } else {
+        value_type value(std::forward<Args>(args)...);
+        shift_elements(index, 1);
+        new (arr_ + index) value_type(std::move(value));
+    }
+    ++size_;
+    return arr_ + index;
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+typename small_vector<T, N>::reference small_vector<T, N>::emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+// private
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::value_type *small_vector<T, N>::inline_data() {
+    return reinterpret_cast<value_type *>(storage_);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::destroy_elements(size_type first) {
+    for (size_type i = first; i < size_; ++i) {
+        arr_[i].~value_type();
+    }
+    size_ = first;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::value_type *small_vector<T, N>::allocate_heap(size_type n) {
+    return static_cast<value_type *>(vector_storage<>::allocate(n * sizeof(value_type), alignof(value_type)));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::release_heap(value_type *buff, size_type n) {
+    vector_storage<>::deallocate(buff, n * sizeof(value_type), alignof(value_type));
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::release_storage() {
+    if (!is_inline()) release_heap(arr_, capacity_);
+    arr_ = inline_data();
+    capacity_ = N;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::take_elements(small_vector &v) {
+    if (!v.is_inline()) {
+        arr_ = v.arr_;
+        size_ = v.size_;
+        capacity_ = v.capacity_;
+        v.arr_ = v.inline_data();
+        v.size_ = 0;
+        v.capacity_ = N;
+    } else {
+        if constexpr (is_trivially_copyable_) {
+            if (v.size_) std::memcpy(arr_, v.arr_, v.size_ * sizeof(value_type));
+            size_ = v.size_;
+        } else {
+            for (; size_ < v.size_; ++size_) {
+                new (arr_ + size_) value_type(std::move(v.arr_[size_]));
+            }
+        }
+        v.destroy_elements(0);
+    }
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::increasing_capacity(size_type count) {
+    if (count > max_size_ - size_) throw std::invalid_argument("Capacity exceeds allowable dimensions");
+    size_type capacity = std::min(std::max<size_type>(capacity_ * 2, 1), max_size_);
+    return std::max(capacity, size_ + count);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::resize_storage(size_type n) {
+    value_type *buff = inline_data();
+    if (n > N) {
+        buff = allocate_heap(n);
+    } else {
+        n = N;
+    }
+    move_elements(buff, n, size_, 0);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::move_elements(value_type *buff, size_type n, size_type gap, size_type count,
+                                       bool filled) {
+    // При исключении старое хранилище остается нетронутым, а buff из кучи освобождается
+    try {
+        detail::relocate_elements(buff, arr_, size_, gap, count, filled);
+    } catch (...) {
+        if (buff != inline_data()) release_heap(buff, n);
+        throw;
+    }
+    if (!is_inline()) release_heap(arr_, capacity_);
+    arr_ = buff;
+    capacity_ = n;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::shift_elements(size_type index, size_type count) {
+    detail::shift_elements(arr_, index, size_, count);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::open_gap(size_type index, size_type count) {
+    if (count > capacity_ - size_) {
+        size_type n = increasing_capacity(count);
+        move_elements(allocate_heap(n), n, index, count);
+    } else {
+        shift_elements(index, count);
+    }
+}
+
+}  // namespace s21
@@ -0,0 +1,102 @@
+#ifndef S21_CONTAINERS_S21_SOA_VECTOR_HPP
+#define S21_CONTAINERS_S21_SOA_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Вектор строк из полей Ts..., где каждое поле хранится в своем непрерывном столбце. Проход по
+// одному полю читает только его столбец, а не всю запись, как в vector<Record>
+template <typename... Ts>
+class soa_vector {
+    static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+
+ public:
+    using size_type = size_t;
+    using value_type = std::tuple<Ts...>;
+    template <std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    class reference;  // Ссылка на строку: доступ к полям через get<I>()
+
+    soa_vector();                                 // Конструктор по умолчанию
+    explicit soa_vector(size_type n);             // n строк из значений по умолчанию
+    soa_vector(const soa_vector &other);          // Конструктор копирования
+    soa_vector(soa_vector &&other) noexcept;      // Конструктор перемещения
+    ~soa_vector() = default;                      // Деструктор
+    soa_vector &operator=(const soa_vector &other);  // Перегрузка опреатора присваивания
+    soa_vector &operator=(soa_vector &&other) noexcept;  // Перегрузка опреатора присваивания
+
+    reference at(size_type pos);          // Строка с проверкой границ
+    reference operator[](size_type pos);  // Строка
+    reference front();                    // Первая строка
+    reference back();                     // Последняя строка
+
+    template <std::size_t I>
+    column_type<I> *data();  // Начало столбца I
+    template <std::size_t I>
+    column_type<I> *begin();  // Итератор в начало столбца I
+    template <std::size_t I>
+    column_type<I> *end();  // Итератор в конец столбца I
+
+    bool empty();                  // проверка контейнера на пустоту
+    size_type size();              // возвращает количество строк
+    size_type capacity();          // строки, которые помещаются во все столбцы без перевыделения
+    void reserve(size_type size);  // резервирует место под size строк в каждом столбце
+    void shrink_to_fit();          // ужимает столбцы до size()
+
+    void clear();                           // удаляет строки, сохраняя емкость
+    void push_back(const Ts &...values);    // добавляет строку из значений полей
+    void push_back(const value_type &row);  // добавляет строку из кортежа
+    template <class... Args>
+    reference emplace_back(Args &&...args);  // добавляет строку, передавая по аргументу в каждый столбец
+    void pop_back();                         // удаляет последнюю строку
+    void swap(soa_vector &other);            // меняет содержимое
+
+    class reference {
+     public:
+        template <std::size_t I>
+        column_type<I> &get();          // Поле I строки
+        operator value_type();          // NOLINT(runtime/explicit) Копия строки в виде кортежа
+        reference &operator=(const value_type &row);  // Записывает поля строки из кортежа
+        reference &operator=(reference other);        // Копирует поля другой строки
+
+     private:
+        friend class soa_vector;
+        reference(soa_vector *owner, size_type index);
+
+        soa_vector *owner_;
+        size_type index_;
+
+        template <std::size_t... Is>
+        value_type to_tuple(std::index_sequence<Is...>);
+        template <std::size_t... Is>
+        void assign(const value_type &row, std::index_sequence<Is...>);
+    };
+
+ private:
+    using indices = std::index_sequence_for<Ts...>;
+
+    std::tuple<vector<Ts>...> columns_;
+    size_type size_;
+
+    template <std::size_t I>
+    vector<column_type<I>> &column();  // Столбец I
+    void prepare_row();                // Резервирует место под еще одну строку во всех столбцах
+    void truncate_columns();           // Обрезает столбцы до size_ после исключения
+    template <class... Args, std::size_t... Is>
+    void append_row(std::index_sequence<Is...>, Args &&...args);  // Добавляет по значению в столбец
+};
+
+}  // namespace s21
+
+#include "s21_soa_vector.inl"
+
+#endif  // S21_CONTAINERS_S21_SOA_VECTOR_HPP
@@ -0,0 +1,230 @@
+#include "s21_soa_vector.hpp"
+
+namespace s21 {
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector() : size_(0) {}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(size_type n) : columns_(vector<Ts>(n)...), size_(n) {}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(const soa_vector &other) : columns_(other.columns_), size_(other.size_) {}
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(soa_vector &&other) noexcept
+    : columns_(std::move(other.columns_)), size_(other.size_) {
+    other.size_ = 0;
+}
+
+template <typename... Ts>
+soa_vector<Ts...> &soa_vector<Ts...>::operator=(const soa_vector &other) {
+    if (this != &other) {
+        columns_ = other.columns_;
+        size_ = other.size_;
+    }
+    return *this;
+}
+
+template <typename... Ts>
+soa_vector<Ts...> &soa_vector<Ts...>::operator=(soa_vector &&other) noexcept {
+    if (this != &other) {
+        columns_ = std::move(other.columns_);
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("The specified element is outside the bounds of the vector");
+    return reference(this, pos);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::operator[](size_type pos) {
+    return reference(this, pos);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::front() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return reference(this, 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    return reference(this, size_ - 1);
+}
+
+template <typename... Ts>
+template <std::size_t I>
+typename soa_vector<Ts...>::template column_type<I> *soa_vector<Ts...>::data() {
+    return column<I>().data();
+}
+
+template <typename... Ts>
+template <std::size_t I>
+typename soa_vector<Ts...>::template column_type<I> *soa_vector<Ts...>::begin() {
+    return column<I>().begin();
+}
+
+template <typename... Ts>
+template <std::size_t I>
+typename soa_vector<Ts...>::template column_type<I> *soa_vector<Ts...>::end() {
+    return column<I>().end();
+}
+
+template <typename... Ts>
+bool soa_vector<Ts...>::empty() {
+    return size_ == 0;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::size() {
+    return size_;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::capacity() {
+    return std::apply([](auto &...columns) { return std::min({columns.capacity()...}); }, columns_);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::reserve(size_type size) {
+    std::apply([size](auto &...columns) { (columns.reserve(size), ...); }, columns_);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::shrink_to_fit() {
+    std::apply([](auto &...columns) { (columns.shrink_to_fit(), ...); }, columns_);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::clear() {
+    std::apply([](auto &...columns) { (columns.clear(), ...); }, columns_);
+    size_ = 0;
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(const Ts &...values) {
+    emplace_back(values...);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(const value_type &row) {
+    std::apply([this](const Ts &...values) { emplace_back(values...); }, row);
+}
+
+template <typename... Ts>
+template <class... Args>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Ts), "emplace_back takes one argument per column");
+    if (capacity() == size_) {
+        // Перевыделение столбцов сделало бы недействительными ссылки из args на строки
+        // самого вектора, поэтому строка собирается до него
+        value_type row(std::forward<Args>(args)...);
+        prepare_row();
+        std::apply([this](Ts &...values) { append_row(indices(), std::move(values)...); }, row);
+    } else {
+        append_row(indices(), std::forward<Args>(args)...);
+    }
+    return reference(this, size_ - 1);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    std::apply([](auto &...columns) { (columns.pop_back(), ...); }, columns_);
+    --size_;
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::swap(soa_vector &other) {
+    if (this != &other) {
+        std::apply([&other](auto &...columns) {
+            std::apply([&columns...](auto &...others) { (columns.swap(others), ...); }, other.columns_);
+        }, columns_);
+        std::swap(size_, other.size_);
+    }
+}
+
+// reference
+
+template <typename... Ts>
+soa_vector<Ts...>::reference::reference(soa_vector *owner, size_type index) : owner_(owner), index_(index) {}
+
+template <typename... Ts>
+template <std::size_t I>
+typename soa_vector<Ts...>::template column_type<I> &soa_vector<Ts...>::reference::get() {
+    return owner_->template column<I>()[index_];
+}
+
+template <typename... Ts>
+soa_vector<Ts...>::reference::operator value_type() {
+    return to_tuple(indices());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference &soa_vector<Ts...>::reference::operator=(const value_type &row) {
+    assign(row, indices());
+    return *this;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference &soa_vector<Ts...>::reference::operator=(reference other) {
+    assign(other.to_tuple(indices()), indices());
+    return *this;
+}
+
+template <typename... Ts>
+template <std::size_t... Is>
+typename soa_vector<Ts...>::value_type soa_vector<Ts...>::reference::to_tuple(std::index_sequence<Is...>) {
+    return value_type(get<Is>()...);
+}
+
+template <typename... Ts>
+template <std::size_t... Is>
+void soa_vector<Ts...>::reference::assign(const value_type &row, std::index_sequence<Is...>) {
+    ((get<Is>() = std::get<Is>(row)), ...);
+}
+
+// private
+
+template <typename... Ts>
+template <std::size_t I>
+vector<typename soa_vector<Ts...>::template column_type<I>> &soa_vector<Ts...>::column() {
+    return std::get<I>(columns_);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::prepare_row() {
+    if (capacity() == size_) reserve(size_ ? size_ * 2 : 1);
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::truncate_columns() {
+    std::apply(
+        [this](auto &...columns) {
+            ((columns.size() > size_ ? columns.pop_back() : void()), ...);
+        },
+        columns_);
+}
+
+template <typename... Ts>
+template <class... Args, std::size_t... Is>
+void soa_vector<Ts...>::append_row(std::index_sequence<Is...>, Args &&...args) {
+    // Емкость уже зарезервирована, поэтому исключение может бросить только конструктор поля;
+    // тогда уже добавленные в этой строке поля снимаются, и столбцы остаются одной длины
+    try {
+        (column<Is>().emplace_back(std::forward<Args>(args)), ...);
+    } catch (...) {
+        truncate_columns();
+        throw;
+    }
+    ++size_;
+}
+
+}  // namespace s21
@@ -0,0 +1,56 @@
+#ifndef S21_CONTAINERS_S21_THREAD_POOL_HPP
+#define S21_CONTAINERS_S21_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>              // NOLINT(build/c++11)
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>  // NOLINT(build/c++11)
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <queue>
+#include <thread>  // NOLINT(build/c++11)
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Пул потоков фиксированного размера с общей очередью задач
+class thread_pool {
+ public:
+    using size_type = size_t;
+
+    explicit thread_pool(size_type threads = std::thread::hardware_concurrency());  // Запускает потоки
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+    ~thread_pool();  // Дожидается выполнения поставленных задач и останавливает потоки
+
+    static thread_pool &default_pool();  // Общий пул по числу ядер
+
+    size_type size();  // Степень параллелизма: число потоков пула (не меньше 1)
+
+    template <class Function>
+    std::future<std::invoke_result_t<Function>> submit(Function f);  // Ставит задачу в очередь
+    template <class Function>
+    void parallel_for(size_type count,
+                      Function f);  // Вызывает f(i) для i из [0, count), дожидаясь всех вызовов
+
+ private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+
+    void worker_loop();                       // Цикл потока: берет задачи, пока пул не остановлен
+    void enqueue(std::function<void()> task);  // Добавляет задачу и будит один поток
+};
+
+}  // namespace s21
+
+#include "s21_thread_pool.inl"
+
+#endif  // S21_CONTAINERS_S21_THREAD_POOL_HPP
@@ -0,0 +1,109 @@
+#include "s21_thread_pool.hpp"
+
+namespace s21 {
+
+inline thread_pool::thread_pool(size_type threads) {
+    threads = std::max<size_type>(threads, 1);
+    workers_.reserve(threads);
+    for (size_type i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { worker_loop(); });
+    }
+}
+
+inline thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+}
+
+inline thread_pool &thread_pool::default_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+inline thread_pool::size_type thread_pool::size() {
+    return workers_.size();
+}
+
+template <class Function>
+std::future<std::invoke_result_t<Function>> thread_pool::submit(Function f) {
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Function>()>>(std::move(f));
+    auto result = task->get_future();
+    enqueue([task] { (*task)(); });
+    return result;
+}
+
+template <class Function>
+void thread_pool::parallel_for(size_type count, Function f) {
+    if (count == 0) return;
+    // Вызывающий поток тоже выбирает индексы, поэтому вложенный вызов из задачи пула не
+    // блокируется, даже если все потоки заняты. Помощники, дошедшие до очереди поздно, не
+    // находят работы и сразу выходят, а состояние живет, пока на него ссылается хотя бы одна задача
+    struct state {
+        explicit state(Function &&function, size_type n) : f(std::move(function)), count(n) {}
+        Function f;
+        size_type count;
+        std::atomic<size_type> next{0};
+        size_type done = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto shared = std::make_shared<state>(std::move(f), count);
+    auto run = [](state &s) {
+        size_type completed = 0;
+        std::exception_ptr error;
+        for (size_type i; (i = s.next.fetch_add(1, std::memory_order_relaxed)) < s.count; ++completed) {
+            try {
+                if (!error) s.f(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        if (completed) {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (error && !s.error) s.error = error;
+            s.done += completed;
+            if (s.done == s.count) s.finished.notify_all();
+        }
+    };
+    size_type helpers = std::min(count, size()) - 1;
+    for (size_type i = 0; i < helpers; ++i) {
+        enqueue([shared, run] { run(*shared); });
+    }
+    run(*shared);
+    std::unique_lock<std::mutex> lock(shared->mutex);
+    shared->finished.wait(lock, [&] { return shared->done == shared->count; });
+    if (shared->error) std::rethrow_exception(shared->error);
+}
+
+// private
+
+inline void thread_pool::worker_loop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+
+inline void thread_pool::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+}  // namespace s21
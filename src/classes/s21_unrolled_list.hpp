@@ -0,0 +1,168 @@
+#ifndef S21_CONTAINERS_S21_UNROLLED_LIST_HPP
+#define S21_CONTAINERS_S21_UNROLLED_LIST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.hpp"
+
+namespace s21 {
+
+// Список блоков, в каждом из которых подряд лежит до block_capacity элементов. Проход читает
+// элементы блока последовательно, а на элемент приходится доля заголовка блока вместо двух
+// указателей. Вставка и удаление сдвигают элементы только внутри одного блока: переполненный блок
+// делится на два, опустевший наполовину сливается с соседом. Итераторы других блоков при этом
+// остаются действительными, итераторы измененного блока и его соседа - нет
+template <class T, std::size_t BlockBytes = 512>
+class unrolled_list {
+    struct block;
+
+ public:
+    template <bool Const>
+    class basic_iterator;
+
+    using value_type = T;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using size_type = size_t;
+
+    static constexpr size_type block_capacity =
+        BlockBytes > 2 * sizeof(void *) + sizeof(size_type) + sizeof(value_type)
+            ? (BlockBytes - 2 * sizeof(void *) - sizeof(size_type)) / sizeof(value_type)
+            : 1;  // Элементов в одном блоке
+
+    unrolled_list();                      // Конструктор по умолчанию
+    explicit unrolled_list(size_type n);  // Конструктор размера n
+    explicit unrolled_list(std::initializer_list<value_type> const
+                               &items);  // Конструктор инициализированный с помощью std::initializer_list
+    unrolled_list(const unrolled_list &l);      // Конструктор копирования
+    unrolled_list(unrolled_list &&l) noexcept;  // Конструктор перемещения
+    ~unrolled_list();                           // Деструктор
+    unrolled_list &operator=(unrolled_list &&l) noexcept;  // Перегрузка опреатора присваивания
+    unrolled_list &operator=(const unrolled_list &l);      // Перегрузка опреатора присваивания
+
+    reference front();  // Доступ к первому элементу
+    reference back();   // Доступ к последнему элементу
+
+    iterator begin();  // Возвращает итератор в начало
+    iterator end();    // Возвращает итератор в конец
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    bool empty() const;          // проверка контейнера на пустоту
+    size_type size() const;      // возвращает количество элементов
+    size_type max_size() const;  // возвращает максимально возможное количество элементов
+
+    void clear();  // удаляет все элементы и блоки
+    iterator insert(const_iterator pos, const_reference value);  // вставляет value перед pos
+    iterator erase(const_iterator pos);  // удаляет элемент, возвращает итератор на следующий
+    void push_back(const_reference value);   // добавляет элемент в конец
+    void pop_back();                         // удаляет последний элемент
+    void push_front(const_reference value);  // добавляет элемент в начало
+    void pop_front();                        // удаляет первый элемент
+    void swap(unrolled_list &other);         // меняет содержимое
+    void merge(unrolled_list &other);        // сливает отсортированный other в отсортированный список
+    template <class Compare>
+    void merge(unrolled_list &other, Compare comp);
+    void splice(const_iterator pos, unrolled_list &other);  // переносит блоки other перед pos
+    void splice(const_iterator pos, unrolled_list &other, const_iterator it);  // переносит элемент it
+    void splice(const_iterator pos, unrolled_list &other, const_iterator first,
+                const_iterator last);  // переносит элементы [first, last) перед pos
+    void reverse();                                         // обращает порядок блоков и элементов в них
+    size_type unique();  // удаляет соседние повторы, возвращает количество удаленных
+    template <class BinaryPredicate>
+    size_type unique(BinaryPredicate pred);
+    void sort();  // устойчивая сортировка
+    template <class Compare>
+    void sort(Compare comp);
+
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args &&...args);  // создает элемент из args перед pos
+    template <class... Args>
+    void emplace_back(Args &&...args);  // создает элемент из args в конце
+    template <class... Args>
+    void emplace_front(Args &&...args);  // создает элемент из args в начале
+
+    template <bool Const>
+    class basic_iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator();
+        // Преобразование iterator в const_iterator
+        template <bool Other, typename = std::enable_if_t<Const && !Other>>
+        basic_iterator(const basic_iterator<Other> &other);  // NOLINT(runtime/explicit)
+
+        reference operator*() const;
+        pointer operator->() const;
+        basic_iterator &operator++();
+        basic_iterator operator++(int);
+        basic_iterator &operator--();
+        basic_iterator operator--(int);
+        bool operator==(const basic_iterator &other) const;
+        bool operator!=(const basic_iterator &other) const;
+
+     private:
+        friend class unrolled_list;
+        friend class basic_iterator<!Const>;
+
+        basic_iterator(block *b, size_type index);
+
+        block *block_;
+        size_type index_;
+    };
+
+ private:
+    struct block {
+        block *next_;
+        block *previous_;
+        size_type size_;
+        alignas(value_type) unsigned char storage_[block_capacity * sizeof(value_type)];
+
+        value_type *data();  // Начало элементов блока
+    };
+
+    static constexpr bool is_trivially_copyable_ =
+        std::is_trivially_copyable<value_type>::value;  // Элементы переносятся memcpy/memmove
+
+    block *head_;
+    block *tail_;
+    size_type size_;
+
+    block *create_block(block *previous);  // Пустой блок после previous, nullptr - в начало
+    void remove_block(block *b);           // Разрушает элементы блока, исключает и освобождает его
+    void link_blocks(block *previous, block *first,
+                     block *last);          // Вставляет цепочку [first, last] после previous
+    void unlink_blocks(block *first, block *last);  // Исключает цепочку [first, last] из списка
+    block *split_block(block *b, size_type index);  // Переносит [index, size_) в новый блок после b
+    block *cut_before(const_iterator pos);  // Блок, начинающийся с pos, делит блок при необходимости
+    void merge_blocks(block *b);  // Переносит элементы следующего блока в b и освобождает его
+    void join_blocks(block *b);   // Сливает b со следующим, если их элементы помещаются в один блок
+    static void move_elements(value_type *dst, value_type *src,
+                              size_type count);  // Перемещает count элементов в dst, разрушая src
+    static void shift_right(value_type *data, size_type index,
+                            size_type size);  // Сдвигает [index, size) на один слот вправо
+    static void shift_left(value_type *data, size_type index,
+                           size_type size);  // Сдвигает (index, size) на место разрушенного index
+};
+
+}  // namespace s21
+
+#include "s21_unrolled_list.inl"
+
+#endif  // S21_CONTAINERS_S21_UNROLLED_LIST_HPP
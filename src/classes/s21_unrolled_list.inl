@@ -0,0 +1,595 @@
+#include "s21_unrolled_list.hpp"
+
+namespace s21 {
+
+// basic_iterator
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::basic_iterator() : block_(nullptr), index_(0) {}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+template <bool Other, typename>
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::basic_iterator(const basic_iterator<Other> &other)
+    : block_(other.block_), index_(other.index_) {}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::basic_iterator(block *b, size_type index)
+    : block_(b), index_(index) {}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>::reference
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator*() const {
+    return block_->data()[index_];
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>::pointer
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator->() const {
+    return block_->data() + index_;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>
+    &unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator++() {
+    // Конец списка - позиция за последним элементом последнего блока
+    if (++index_ == block_->size_ && block_->next_) {
+        block_ = block_->next_;
+        index_ = 0;
+    }
+    return *this;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator++(int) {
+    basic_iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>
+    &unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator--() {
+    if (index_ == 0) {
+        block_ = block_->previous_;
+        index_ = block_->size_;
+    }
+    --index_;
+    return *this;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+typename unrolled_list<T, BlockBytes>::template basic_iterator<Const>
+unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator--(int) {
+    basic_iterator result(*this);
+    --*this;
+    return result;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+bool unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator==(const basic_iterator &other) const {
+    return block_ == other.block_ && index_ == other.index_;
+}
+
+template <class T, std::size_t BlockBytes>
+template <bool Const>
+bool unrolled_list<T, BlockBytes>::basic_iterator<Const>::operator!=(const basic_iterator &other) const {
+    return !(*this == other);
+}
+
+// unrolled_list
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list() : head_(nullptr), tail_(nullptr), size_(0) {}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(size_type n) : unrolled_list() {
+    for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(std::initializer_list<value_type> const &items)
+    : unrolled_list() {
+    for (const_reference item : items) push_back(item);
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(const unrolled_list &l) : unrolled_list() {
+    for (const_reference item : l) push_back(item);
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::unrolled_list(unrolled_list &&l) noexcept : unrolled_list() {
+    swap(l);
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes>::~unrolled_list() {
+    clear();
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes> &unrolled_list<T, BlockBytes>::operator=(unrolled_list &&l) noexcept {
+    if (this != &l) {
+        clear();
+        swap(l);
+    }
+    return *this;
+}
+
+template <class T, std::size_t BlockBytes>
+unrolled_list<T, BlockBytes> &unrolled_list<T, BlockBytes>::operator=(const unrolled_list &l) {
+    if (this != &l) {
+        unrolled_list copy(l);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::reference unrolled_list<T, BlockBytes>::front() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    return head_->data()[0];
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::reference unrolled_list<T, BlockBytes>::back() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    return tail_->data()[tail_->size_ - 1];
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator unrolled_list<T, BlockBytes>::begin() {
+    return iterator(head_, 0);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator unrolled_list<T, BlockBytes>::end() {
+    return iterator(tail_, tail_ ? tail_->size_ : 0);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::const_iterator unrolled_list<T, BlockBytes>::begin() const {
+    return const_iterator(head_, 0);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::const_iterator unrolled_list<T, BlockBytes>::end() const {
+    return const_iterator(tail_, tail_ ? tail_->size_ : 0);
+}
+
+template <class T, std::size_t BlockBytes>
+bool unrolled_list<T, BlockBytes>::empty() const {
+    return size_ == 0;
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::size_type unrolled_list<T, BlockBytes>::size() const {
+    return size_;
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::size_type unrolled_list<T, BlockBytes>::max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::clear() {
+    while (head_) remove_block(head_);
+    size_ = 0;
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator unrolled_list<T, BlockBytes>::insert(const_iterator pos,
+                                                                                     const_reference value) {
+    return emplace(pos, value);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::iterator unrolled_list<T, BlockBytes>::erase(const_iterator pos) {
+    block *b = pos.block_;
+    size_type index = pos.index_;
+    value_type *data = b->data();
+    data[index].~value_type();
+    shift_left(data, index, b->size_);
+    --b->size_;
+    --size_;
+    if (b->size_ == 0) {
+        block *next = b->next_;
+        remove_block(b);
+        return next ? iterator(next, 0) : end();
+    }
+    if (b->size_ < block_capacity / 2) {
+        if (b->next_ && b->size_ + b->next_->size_ <= block_capacity) {
+            merge_blocks(b);
+        } else if (b->previous_ && b->previous_->size_ + b->size_ <= block_capacity) {
+            index += b->previous_->size_;
+            b = b->previous_;
+            merge_blocks(b);
+        }
+    }
+    if (index == b->size_ && b->next_) return iterator(b->next_, 0);
+    return iterator(b, index);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    tail_->data()[--tail_->size_].~value_type();
+    --size_;
+    if (tail_->size_ == 0) remove_block(tail_);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::push_front(const_reference value) {
+    emplace_front(value);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::pop_front() {
+    if (size_ == 0) throw std::out_of_range("The list contains no elements");
+    value_type *data = head_->data();
+    data[0].~value_type();
+    shift_left(data, 0, head_->size_);
+    --size_;
+    if (--head_->size_ == 0) remove_block(head_);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::swap(unrolled_list &other) {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::merge(unrolled_list &other) {
+    merge(other, std::less<T>());
+}
+
+template <class T, std::size_t BlockBytes>
+template <class Compare>
+void unrolled_list<T, BlockBytes>::merge(unrolled_list &other, Compare comp) {
+    // Элементы перемещаются в новые, целиком заполненные блоки за один проход по обоим спискам
+    if (this == &other || other.empty()) return;
+    unrolled_list result;
+    iterator first1 = begin(), last1 = end();
+    iterator first2 = other.begin(), last2 = other.end();
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first2, *first1)) {
+            result.emplace_back(std::move(*first2++));
+        } else {
+            result.emplace_back(std::move(*first1++));
+        }
+    }
+    for (; first1 != last1; ++first1) result.emplace_back(std::move(*first1));
+    for (; first2 != last2; ++first2) result.emplace_back(std::move(*first2));
+    swap(result);
+    other.clear();
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::splice(const_iterator pos, unrolled_list &other) {
+    // Блоки other переносятся целиком; блок с pos делится, если pos не на его границе,
+    // а неполные блоки на стыках сливаются с соседями
+    if (this == &other || !other.head_) return;
+    block *previous = nullptr;
+    if (!pos.block_) {
+        previous = tail_;
+    } else if (pos.index_ == 0) {
+        previous = pos.block_->previous_;
+    } else {
+        if (pos.index_ < pos.block_->size_) split_block(pos.block_, pos.index_);
+        previous = pos.block_;
+    }
+    block *last = other.tail_;
+    link_blocks(previous, other.head_, last);
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+    join_blocks(last);
+    join_blocks(previous);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::splice(const_iterator pos, unrolled_list &other, const_iterator it) {
+    // Элемент другого списка перемещается в блок pos, отдельный блок под него не создается
+    if (this == &other) {
+        if (pos != it) splice(pos, other, it, std::next(it));
+        return;
+    }
+    emplace(pos, std::move(*iterator(it.block_, it.index_)));
+    other.erase(it);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::splice(const_iterator pos, unrolled_list &other, const_iterator first,
+                                          const_iterator last) {
+    // Крайние блоки диапазона и блок pos делятся так, чтобы границы пришлись на начала блоков: блоки
+    // внутри диапазона переносятся целиком, а перемещаются только элементы неполных крайних блоков.
+    // Деление сдвигает элементы правее точки деления, поэтому более дальние точки делятся первыми
+    if (first == last || (this == &other && pos == last)) return;
+    block *next = nullptr;
+    bool pos_after = this == &other && pos.block_ == last.block_ && pos.index_ > last.index_;
+    if (pos_after) next = cut_before(pos);
+    block *stop = other.cut_before(last);
+    block *start = other.cut_before(first);
+    if (!pos_after) next = cut_before(pos);
+
+    block *finish = stop ? stop->previous_ : other.tail_;
+    size_type count = 0;
+    for (block *b = start;; b = b->next_) {
+        count += b->size_;
+        if (b == finish) break;
+    }
+    block *before = start->previous_;
+    other.unlink_blocks(start, finish);
+    other.size_ -= count;
+    other.join_blocks(before);
+
+    block *previous = next ? next->previous_ : tail_;
+    link_blocks(previous, start, finish);
+    size_ += count;
+    join_blocks(finish);
+    join_blocks(previous);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::reverse() {
+    for (block *b = head_; b; b = b->previous_) {
+        std::swap(b->next_, b->previous_);
+        std::reverse(b->data(), b->data() + b->size_);
+    }
+    std::swap(head_, tail_);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::size_type unrolled_list<T, BlockBytes>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <class T, std::size_t BlockBytes>
+template <class BinaryPredicate>
+typename unrolled_list<T, BlockBytes>::size_type unrolled_list<T, BlockBytes>::unique(BinaryPredicate pred) {
+    // Каждый блок уплотняется на месте и сливается с предыдущим, если их элементы помещаются в один
+    // блок; сравнение идет с последним оставленным элементом, который может лежать в предыдущем блоке
+    size_type removed = 0;
+    value_type *kept = nullptr;
+    for (block *b = head_; b;) {
+        value_type *data = b->data();
+        size_type write = 0;
+        for (size_type read = 0; read < b->size_; ++read) {
+            if (kept && pred(*kept, data[read])) {
+                ++removed;
+                continue;
+            }
+            if (write != read) data[write] = std::move(data[read]);
+            kept = data + write++;
+        }
+        for (size_type i = write; i < b->size_; ++i) data[i].~value_type();
+        b->size_ = write;
+        block *next = b->next_;
+        block *previous = b->previous_;
+        if (write == 0) {
+            remove_block(b);
+        } else if (previous && previous->size_ + write <= block_capacity) {
+            merge_blocks(previous);
+            kept = previous->data() + previous->size_ - 1;
+        }
+        b = next;
+    }
+    size_ -= removed;
+    return removed;
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::sort() {
+    sort(std::less<T>());
+}
+
+template <class T, std::size_t BlockBytes>
+template <class Compare>
+void unrolled_list<T, BlockBytes>::sort(Compare comp) {
+    // Элементы не привязаны к узлам, поэтому сортируются в непрерывном буфере и возвращаются на места
+    vector<value_type> buffer;
+    buffer.reserve(size_);
+    for (reference item : *this) buffer.push_back(std::move(item));
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    value_type *source = buffer.begin();
+    for (reference item : *this) item = std::move(*source++);
+}
+
+template <class T, std::size_t BlockBytes>
+template <class... Args>
+typename unrolled_list<T, BlockBytes>::iterator unrolled_list<T, BlockBytes>::emplace(const_iterator pos,
+                                                                                      Args &&...args) {
+    block *b = pos.block_;
+    size_type index = pos.index_;
+    if (b && index == b->size_ && b->size_ < block_capacity) {
+        new (b->data() + index) value_type(std::forward<Args>(args)...);
+        ++b->size_;
+        ++size_;
+        return iterator(b, index);
+    }
+    // Деление блока перемещает элементы, на которые могут ссылаться args
+    value_type value(std::forward<Args>(args)...);
+    if (!b) {
+        b = create_block(nullptr);
+    } else if (index == 0 && b->previous_ && b->previous_->size_ < block_capacity) {
+        b = b->previous_;
+        index = b->size_;
+    } else if (b->size_ == block_capacity) {
+        if (index == block_capacity) {
+            b = create_block(b);
+            index = 0;
+        } else if (index == 0) {
+            b = create_block(b->previous_);
+        } else {
+            // У края блока он делится в точке вставки: вставки подряд у конца или начала
+            // заполняют блоки целиком, а не оставляют за собой половинки
+            size_type quarter = block_capacity / 4;
+            bool at_edge = index < quarter || index > block_capacity - quarter;
+            size_type split = at_edge ? index : block_capacity / 2;
+            block *upper = split_block(b, split);
+            if (index > split) {
+                b = upper;
+                index -= split;
+            }
+        }
+    }
+    shift_right(b->data(), index, b->size_);
+    new (b->data() + index) value_type(std::move(value));
+    ++b->size_;
+    ++size_;
+    return iterator(b, index);
+}
+
+template <class T, std::size_t BlockBytes>
+template <class... Args>
+void unrolled_list<T, BlockBytes>::emplace_back(Args &&...args) {
+    emplace(end(), std::forward<Args>(args)...);
+}
+
+template <class T, std::size_t BlockBytes>
+template <class... Args>
+void unrolled_list<T, BlockBytes>::emplace_front(Args &&...args) {
+    emplace(begin(), std::forward<Args>(args)...);
+}
+
+// private
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::value_type *unrolled_list<T, BlockBytes>::block::data() {
+    return reinterpret_cast<value_type *>(storage_);
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::block *unrolled_list<T, BlockBytes>::create_block(block *previous) {
+    block *b = new block;
+    b->size_ = 0;
+    link_blocks(previous, b, b);
+    return b;
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::remove_block(block *b) {
+    for (size_type i = 0; i < b->size_; ++i) b->data()[i].~value_type();
+    unlink_blocks(b, b);
+    delete b;
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::link_blocks(block *previous, block *first, block *last) {
+    block *next = previous ? previous->next_ : head_;
+    first->previous_ = previous;
+    last->next_ = next;
+    if (previous) {
+        previous->next_ = first;
+    } else {
+        head_ = first;
+    }
+    if (next) {
+        next->previous_ = last;
+    } else {
+        tail_ = last;
+    }
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::unlink_blocks(block *first, block *last) {
+    if (first->previous_) {
+        first->previous_->next_ = last->next_;
+    } else {
+        head_ = last->next_;
+    }
+    if (last->next_) {
+        last->next_->previous_ = first->previous_;
+    } else {
+        tail_ = first->previous_;
+    }
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::block *unrolled_list<T, BlockBytes>::split_block(block *b,
+                                                                                        size_type index) {
+    block *upper = create_block(b);
+    move_elements(upper->data(), b->data() + index, b->size_ - index);
+    upper->size_ = b->size_ - index;
+    b->size_ = index;
+    return upper;
+}
+
+template <class T, std::size_t BlockBytes>
+typename unrolled_list<T, BlockBytes>::block *unrolled_list<T, BlockBytes>::cut_before(const_iterator pos) {
+    if (!pos.block_ || pos.index_ == 0) return pos.block_;
+    if (pos.index_ == pos.block_->size_) return pos.block_->next_;
+    return split_block(pos.block_, pos.index_);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::merge_blocks(block *b) {
+    block *next = b->next_;
+    move_elements(b->data() + b->size_, next->data(), next->size_);
+    b->size_ += next->size_;
+    next->size_ = 0;
+    remove_block(next);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::join_blocks(block *b) {
+    if (b && b->next_ && b->size_ + b->next_->size_ <= block_capacity) merge_blocks(b);
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::move_elements(value_type *dst, value_type *src, size_type count) {
+    if constexpr (is_trivially_copyable_) {
+        if (count) std::memcpy(dst, src, count * sizeof(value_type));
+    } else {
+        for (size_type i = 0; i < count; ++i) {
+            new (dst + i) value_type(std::move(src[i]));
+            src[i].~value_type();
+        }
+    }
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::shift_right(value_type *data, size_type index, size_type size) {
+    if constexpr (is_trivially_copyable_) {
+        std::memmove(data + index + 1, data + index, (size - index) * sizeof(value_type));
+    } else {
+        for (size_type i = size; i-- > index;) {
+            new (data + i + 1) value_type(std::move(data[i]));
+            data[i].~value_type();
+        }
+    }
+}
+
+template <class T, std::size_t BlockBytes>
+void unrolled_list<T, BlockBytes>::shift_left(value_type *data, size_type index, size_type size) {
+    if constexpr (is_trivially_copyable_) {
+        std::memmove(data + index, data + index + 1, (size - index - 1) * sizeof(value_type));
+    } else {
+        for (size_type i = index; i + 1 < size; ++i) {
+            new (data + i) value_type(std::move(data[i + 1]));
+            data[i + 1].~value_type();
+        }
+    }
+}
+
+}  // namespace s21
@@ -1,14 +1,25 @@
 #ifndef S21_CONTAINERS_S21_VECTOR_HPP
 #define S21_CONTAINERS_S21_VECTOR_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "s21_vector_growth.hpp"
+#include "s21_vector_relocation.hpp"
+#include "s21_vector_storage.hpp"
+
 namespace s21 {
 
-template <typename T>
+// Storage - политика выделения буфера (vector_storage): выравнивание data() и режим huge pages.
+// Growth - политика роста и сжатия емкости (s21_vector_growth.hpp)
+template <typename T, class Storage = default_vector_storage, class Growth = default_vector_growth>
 class vector {
  public:
     using value_type = T;
@@ -23,9 +34,9 @@ class vector {
     explicit vector(std::initializer_list<value_type> const
                         &items);  // Конструктор инициализированный с помощью std::list
     vector(const vector &v);             // Конструктор копирования
-    vector(vector &&v);                  // Конструктор перемещения
+    vector(vector &&v) noexcept;         // Конструктор перемещения
     ~vector();                           // Деструктор
-    vector &operator=(vector &&v);       // Перегрузка опреатора присваивания
+    vector &operator=(vector &&v) noexcept;  // Перегрузка опреатора присваивания
     vector &operator=(const vector &v);  // Перегрузка опреатора присваивания
 
     reference at(size_type pos);  // Доступ к указанному элементу с проверкой границ
@@ -46,12 +57,22 @@ class vector {
                            // момент памяти
     void shrink_to_fit();  // уменьшает использование памяти, освобождая неиспользуемую память
 
-    void clear();  // Очищает содержимое
+    void clear();  // Очищает содержимое, сохраняя емкость
     iterator insert(iterator pos,
                     const_reference value);  // вставляет элементы в конкретную позицию и возвращает итератор,
                                              // указывающий на новый элемент
+    iterator insert(iterator pos, size_type count,
+                    const_reference value);  // вставляет count копий value перед pos
+    template <class ForwardIt,
+              typename = std::enable_if_t<!std::is_integral<ForwardIt>::value>>
+    iterator insert(iterator pos, ForwardIt first,
+                    ForwardIt last);  // вставляет диапазон [first, last) перед pos одним сдвигом хвоста
     void erase(iterator pos);                // стирает элемент в позиции
+    iterator erase(iterator first, iterator last);  // стирает диапазон [first, last) одним сдвигом хвоста
+    template <class Predicate>
+    size_type erase_if(Predicate pred);  // удаляет элементы, для которых pred истинен, за один проход
     void push_back(const_reference value);   // добавляет элемент в конец
+    void push_back(value_type &&value);      // перемещает элемент в конец
     void pop_back();                         // удаляет последний элемент
     void swap(vector &other);                // меняет содержимое
 
@@ -60,20 +81,39 @@ class vector {
 
     template <class... Args>
     iterator emplace(const_iterator pos,
-                     Args &&...args);  // вставляет новые элементы в контейнер непосредственно перед pos
+                     Args &&...args);  // создает элемент из args непосредственно перед pos
     template <class... Args>
-    void emplace_back(Args &&...args);  // добавляет новые элементы в конец контейнера
+    reference emplace_back(Args &&...args);  // создает элемент из args в конце контейнера
 
  private:
     size_type size_;
     size_type capacity_;
     value_type *arr_;
     size_type max_size_ = std::numeric_limits<size_t>::max() / sizeof(value_type) / 2;
-    bool flag_increase_vector = 1;
+    static constexpr bool is_trivially_copyable_ =
+        std::is_trivially_copyable<value_type>::value;  // Элементы переносятся memcpy/memmove
 
-    void create_vector(size_type n);  // Выделяет память
-    void increasing_vector_capacity();
-    void resize_vector();  // Увеличивает емкость вектора
+    void create_vector(size_type n);  // Выделяет неинициализированную память под n элементов
+    static value_type *allocate_storage(size_type n);  // Выделяет сырую память без вызова конструкторов
+    static void release_storage(value_type *buff, size_type n);  // Освобождает память емкости n
+    void destroy_vector_elements(size_type first);  // Разрушает элементы [first, size_)
+    size_type increasing_vector_capacity(
+        size_type count = 1);  // Вычисляет новую емкость для еще count элементов по Growth::grow
+    void shrink_vector();      // Уменьшает емкость, если этого требует Growth::shrink
+    void resize_vector(size_type n);  // Переносит элементы в новое хранилище емкости n
+    bool is_reallocatable(size_type n);  // Storage перенесет элементы в емкость n без копирования (mremap)
+    void reallocate_vector(size_type n);  // Меняет емкость на n средствами Storage::reallocate
+    // Переносит элементы в buff, оставляя count слотов с gap; filled - слоты уже заняты созданными
+    // элементами, которые при исключении разрушаются вместе с buff
+    void move_vector_elements(value_type *buff, size_type n, size_type gap, size_type count,
+                              bool filled = false);
+    void shift_vector_elements(size_type index,
+                               size_type count);  // Сдвигает хвост с index на count слотов вправо
+    void open_vector_gap(size_type index,
+                         size_type count);  // Освобождает count слотов с index, расширяясь не более раза
+    template <class Construct>
+    void fill_vector_gap(size_type index, size_type count,
+                         Construct construct);  // Создает элементы в слотах, при исключении откатывает сдвиг
     void copy_vector_elements(const vector &v1, vector &v2);  // Копирует элементы вектора
 };
 
@@ -2,249 +2,363 @@
 
 namespace s21 {
 
-template <typename value_type>
-vector<value_type>::vector() : size_(0), capacity_(0), arr_(nullptr) {}
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::vector() : size_(0), capacity_(0), arr_(nullptr) {}
 
-template <typename value_type>
-void vector<value_type>::create_vector(size_type n) {
-    if (n == 0)
-        arr_ = nullptr;
-    else
-        arr_ = new value_type[n];
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::create_vector(size_type n) {
+    arr_ = allocate_storage(n);
 }
 
-template <typename value_type>
-vector<value_type>::vector(size_type n) : size_(n), capacity_(n) {
+template <typename value_type, class Storage, class Growth>
+value_type *vector<value_type, Storage, Growth>::allocate_storage(size_type n) {
+    if (n == 0) return nullptr;
+    return static_cast<value_type *>(Storage::allocate(n * sizeof(value_type), alignof(value_type)));
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::release_storage(value_type *buff, size_type n) {
+    Storage::deallocate(buff, n * sizeof(value_type), alignof(value_type));
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::destroy_vector_elements(size_type first) {
+    for (size_type i = first; i < size_; ++i) {
+        arr_[i].~value_type();
+    }
+    size_ = first;
+}
+
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::vector(size_type n) : size_(0), capacity_(n) {
     if (n > max_size_) throw std::length_error("Vector has exceeded the maximum size values");
-    create_vector(size_);
+    create_vector(capacity_);
+    for (; size_ < n; ++size_) {
+        new (arr_ + size_) value_type();
+    }
 }
 
-template <typename value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const &items)
-    : size_(items.size()), capacity_(items.size()) {
-    create_vector(size_);
-    size_type i = 0;
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::vector(std::initializer_list<value_type> const &items)
+    : size_(0), capacity_(items.size()) {
+    create_vector(capacity_);
     for (auto pos = items.begin(); pos != items.end(); ++pos) {
-        arr_[i++] = *pos;
+        new (arr_ + size_++) value_type(*pos);
     }
 }
 
-template <typename value_type>
-vector<value_type>::vector(const vector &v) : vector() {
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::vector(const vector &v) : vector() {
     if (this == &v) throw std::out_of_range("Error. Incorrect data");
     *this = v;
 }
 
-template <typename value_type>
-void vector<value_type>::remove_vector() {
-    if (arr_) {
-        delete[] arr_;
-        arr_ = nullptr;
-    }
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::remove_vector() {
+    destroy_vector_elements(0);
+    release_storage(arr_, capacity_);
+    arr_ = nullptr;
+    capacity_ = 0;
 }
 
-template <typename value_type>
-vector<value_type>::vector(vector &&v) : vector() {
-    *this = std::move(v);
-    v.remove_vector();
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::vector(vector &&v) noexcept
+    : size_(v.size_), capacity_(v.capacity_), arr_(v.arr_) {
     v.size_ = 0;
     v.capacity_ = 0;
+    v.arr_ = nullptr;
 }
 
-template <typename value_type>
-vector<value_type>::~vector() {
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth>::~vector() {
     remove_vector();
 }
 
-template <typename value_type>
-vector<value_type> &vector<value_type>::operator=(vector &&v) {
-    if (this == &v) throw std::out_of_range("Error. Incorrect data");
-    *this = v;
-    v.remove_vector();
-    v.size_ = 0;
-    v.capacity_ = 0;
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth> &vector<value_type, Storage, Growth>::operator=(vector &&v) noexcept {
+    if (this != &v) {
+        remove_vector();
+        swap(v);
+    }
     return *this;
 }
 
-template <typename value_type>
-vector<value_type> &vector<value_type>::operator=(const vector &v) {
+template <typename value_type, class Storage, class Growth>
+vector<value_type, Storage, Growth> &vector<value_type, Storage, Growth>::operator=(const vector &v) {
     if (this == &v) throw std::out_of_range("Error. Incorrect data");
     remove_vector();
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    create_vector(size_);
+    capacity_ = v.size_;
+    create_vector(capacity_);
     copy_vector_elements(v, *this);
     return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::reference vector<value_type, Storage, Growth>::at(
+    size_type pos) {
     if (pos >= size_) throw std::out_of_range("The specified element is outside the bounds of the vector");
     return *(arr_ + pos);
 }
 
-template <typename value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](size_type pos) {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::reference vector<value_type, Storage, Growth>::operator[](
+    size_type pos) {
     return *(arr_ + pos);
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() {
-    if (!arr_) throw std::out_of_range("The vector contains no elements");
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::const_reference vector<value_type, Storage, Growth>::front() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
     return *arr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() {
-    if (!arr_) throw std::out_of_range("The vector contains no elements");
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::const_reference vector<value_type, Storage, Growth>::back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
     return *(arr_ + size_ - 1);
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::data() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::data() {
     return arr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::begin() {
     return arr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::end() {
     return arr_ + size_;
 }
 
-template <typename value_type>
-bool vector<value_type>::empty() {
+template <typename value_type, class Storage, class Growth>
+bool vector<value_type, Storage, Growth>::empty() {
     return size_ == 0;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::size() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::size_type vector<value_type, Storage, Growth>::size() {
     return size_;
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::max_size() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::size_type vector<value_type, Storage, Growth>::max_size() {
     return max_size_;
 }
 
-template <typename value_type>
-void vector<value_type>::reserve(size_t size) {
-    if (size > capacity_) {
-        capacity_ = size;
-        value_type *buff = new value_type[size]();
-        for (size_type i = 0; i < size_; ++i) {
-            buff[i] = arr_[i];
-        }
-        std::swap(arr_, buff);
-        delete[] buff;
-    }
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::reserve(size_t size) {
+    if (size > max_size_) throw std::length_error("Vector has exceeded the maximum size values");
+    if (size > capacity_) resize_vector(size);
 }
 
-template <typename value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity() {
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::size_type vector<value_type, Storage, Growth>::capacity() {
     return capacity_;
 }
 
-template <typename value_type>
-void vector<value_type>::increasing_vector_capacity() {
-    capacity_ = size_ * 2;
-    if (capacity_ >= max_size_) throw std::invalid_argument("Capacity exceeds allowable dimensions");
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::size_type
+vector<value_type, Storage, Growth>::increasing_vector_capacity(size_type count) {
+    if (count > max_size_ - size_) throw std::invalid_argument("Capacity exceeds allowable dimensions");
+    size_type capacity = std::min(Growth::grow(capacity_, size_ + count, sizeof(value_type)), max_size_);
+    return std::max(capacity, size_ + count);
 }
 
-template <typename value_type>
-void vector<value_type>::copy_vector_elements(const vector &v1, vector &v2) {
-    if (&v1 != &v2 || v1.size_ != v2.size_) {
-        for (size_type i = 0; i < v1.size_; ++i) {
-            v2.arr_[i] = v1.arr_[i];
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::shrink_vector() {
+    size_type n = Growth::shrink(size_, capacity_);
+    if (n < capacity_) resize_vector(std::max(n, size_));
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::copy_vector_elements(const vector &v1, vector &v2) {
+    if (&v1 != &v2) {
+        if constexpr (is_trivially_copyable_) {
+            if (v1.size_) std::memcpy(v2.arr_, v1.arr_, v1.size_ * sizeof(value_type));
+            v2.size_ = v1.size_;
+        } else {
+            for (; v2.size_ < v1.size_; ++v2.size_) {
+                new (v2.arr_ + v2.size_) value_type(v1.arr_[v2.size_]);
+            }
         }
     }
 }
 
-template <typename value_type>
-void vector<value_type>::resize_vector() {
-    vector tmp(*this);
-    remove_vector();
-    size_ = tmp.size_;
-    if (flag_increase_vector == 1 && size_ >= capacity_) {
-        increasing_vector_capacity();
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::resize_vector(size_type n) {
+    if (is_reallocatable(n)) {
+        reallocate_vector(n);
+    } else {
+        move_vector_elements(allocate_storage(n), n, size_, 0);
     }
-    if (flag_increase_vector == 0) {
-        capacity_ = size_;
+}
+
+template <typename value_type, class Storage, class Growth>
+bool vector<value_type, Storage, Growth>::is_reallocatable(size_type n) {
+    if constexpr (is_trivially_copyable_) {
+        return arr_ != nullptr && n > 0 &&
+               Storage::can_reallocate(capacity_ * sizeof(value_type), n * sizeof(value_type),
+                                       alignof(value_type));
     }
-    create_vector(capacity_);
-    copy_vector_elements(tmp, *this);
+    return false;
 }
 
-template <typename value_type>
-void vector<value_type>::shrink_to_fit() {
-    flag_increase_vector = 0;
-    resize_vector();
-    flag_increase_vector = 1;
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::reallocate_vector(size_type n) {
+    arr_ = static_cast<value_type *>(Storage::reallocate(arr_, capacity_ * sizeof(value_type),
+                                                         n * sizeof(value_type), alignof(value_type)));
+    capacity_ = n;
 }
 
-template <typename value_type>
-void vector<value_type>::clear() {
-    remove_vector();
-    size_ = 0;
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::move_vector_elements(value_type *buff, size_type n, size_type gap,
+                                                               size_type count, bool filled) {
+    // При исключении старое хранилище остается нетронутым, а buff освобождается
+    try {
+        detail::relocate_elements(buff, arr_, size_, gap, count, filled);
+    } catch (...) {
+        release_storage(buff, n);
+        throw;
+    }
+    release_storage(arr_, capacity_);
+    arr_ = buff;
+    capacity_ = n;
 }
 
-template <typename value_type>
-typename vector<value_type>::iterator vector<value_type>::insert(iterator pos, const_reference value) {
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::shift_vector_elements(size_type index, size_type count) {
+    detail::shift_elements(arr_, index, size_, count);
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::open_vector_gap(size_type index, size_type count) {
+    if (count > capacity_ - size_) {
+        size_type n = increasing_vector_capacity(count);
+        if (is_reallocatable(n)) {
+            reallocate_vector(n);
+            shift_vector_elements(index, count);
+        } else {
+            move_vector_elements(allocate_storage(n), n, index, count);
+        }
+    } else {
+        shift_vector_elements(index, count);
+    }
+}
+
+template <typename value_type, class Storage, class Growth>
+template <class Construct>
+void vector<value_type, Storage, Growth>::fill_vector_gap(size_type index, size_type count,
+                                                          Construct construct) {
+    // Если конструктор бросит исключение, созданные элементы разрушаются, а хвост возвращается
+    // на место, поэтому вектор остается прежним, кроме возможного роста емкости
+    detail::fill_gap(arr_, index, size_, count, construct);
+    size_ += count;
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::shrink_to_fit() {
+    if (capacity_ > size_) resize_vector(size_);
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::clear() {
+    destroy_vector_elements(0);
+}
+
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::insert(
+    iterator pos, const_reference value) {
+    return emplace(pos, value);
+}
+
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::insert(
+    iterator pos, size_type count, const_reference value) {
     size_type index = pos - arr_;
-    if (size_ == capacity_) {
-        reserve(capacity_ * 2);
+    if (count > 0) {
+        value_type copy(value);
+        open_vector_gap(index, count);
+        fill_vector_gap(index, count, [&copy](value_type *slot) { new (slot) value_type(copy); });
     }
-    for (size_type i = size_, j = size_ - 1; i > 0; --i, --j) {
-        arr_[i] = arr_[j];
-        if (i == index) {
-            arr_[i] = value;
-            ++j;
+    return arr_ + index;
+}
+
+template <typename value_type, class Storage, class Growth>
+template <class ForwardIt, typename>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::insert(
+    iterator pos, ForwardIt first, ForwardIt last) {
+    size_type index = pos - arr_;
+    size_type count = std::distance(first, last);
+    if (count > 0) {
+        open_vector_gap(index, count);
+        fill_vector_gap(index, count, [&first](value_type *slot) { new (slot) value_type(*first++); });
+    }
+    return arr_ + index;
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::erase(iterator pos) {
+    if (pos != end()) erase(pos, pos + 1);
+}
+
+template <typename value_type, class Storage, class Growth>
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::erase(
+    iterator first, iterator last) {
+    size_type index = first - arr_;
+    size_type count = last - first;
+    if (count > 0) {
+        if constexpr (is_trivially_copyable_) {
+            std::memmove(first, last, (end() - last) * sizeof(value_type));
+        } else {
+            for (; last != end(); ++first, ++last) {
+                *first = std::move(*last);
+            }
         }
+        destroy_vector_elements(size_ - count);
+        shrink_vector();
     }
-    ++size_;
-    arr_[index] = value;
-    pos = arr_ + index;
-    return pos;
-}
-
-template <typename value_type>
-void vector<value_type>::erase(iterator pos) {
-    if (pos != end()) {
-        size_type index = pos - begin();
-        pos = begin() + index;
-        for (auto i = pos; i != end() - 1; ++i) {
-            *i = *(i + 1);
+    return arr_ + index;
+}
+
+template <typename value_type, class Storage, class Growth>
+template <class Predicate>
+typename vector<value_type, Storage, Growth>::size_type vector<value_type, Storage, Growth>::erase_if(
+    Predicate pred) {
+    size_type kept = 0;
+    for (size_type i = 0; i < size_; ++i) {
+        if (!pred(arr_[i])) {
+            if (kept != i) arr_[kept] = std::move(arr_[i]);
+            ++kept;
         }
     }
-    --size_;
+    size_type removed = size_ - kept;
+    destroy_vector_elements(kept);
+    if (removed) shrink_vector();
+    return removed;
 }
 
-template <typename value_type>
-void vector<value_type>::push_back(const_reference value) {
-    if (arr_) {
-        resize_vector();
-        auto pos = end();
-        *pos = value;
-        ++size_;
-    } else {
-        size_ = capacity_ = 1;
-        create_vector(size_);
-        auto pos = begin();
-        *pos = value;
-    }
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::push_back(const_reference value) {
+    emplace_back(value);
 }
 
-template <typename value_type>
-void vector<value_type>::pop_back() {
-    if (!arr_) throw std::out_of_range("The vector contains no elements");
-    --size_;
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::push_back(value_type &&value) {
+    emplace_back(std::move(value));
 }
 
-template <typename value_type>
-void vector<value_type>::swap(vector &other) {
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::pop_back() {
+    if (size_ == 0) throw std::out_of_range("The vector contains no elements");
+    destroy_vector_elements(size_ - 1);
+    shrink_vector();
+}
+
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::swap(vector &other) {
     if (this != &other) {
         std::swap(size_, other.size_);
         std::swap(capacity_, other.capacity_);
@@ -252,30 +366,51 @@ void vector<value_type>::swap(vector &other) {
     }
 }
 
-template <typename value_type>
-void vector<value_type>::set_vector_value(size_type i, const_reference value) {
+template <typename value_type, class Storage, class Growth>
+void vector<value_type, Storage, Growth>::set_vector_value(size_type i, const_reference value) {
     if (arr_) arr_[i] = value;
 }
 
-template <typename value_type>
+template <typename value_type, class Storage, class Growth>
 template <class... Args>
-typename vector<value_type>::iterator vector<value_type>::emplace(const_iterator pos, Args &&...args) {
-    const auto arg_vector = {args...};
-    auto value = arg_vector.begin();
-    iterator result = nullptr;
-    for (; value != arg_vector.end(); ++value) {
-        result = insert(const_cast<int *>(pos), *value);
+typename vector<value_type, Storage, Growth>::iterator vector<value_type, Storage, Growth>::emplace(
+    const_iterator pos, Args &&...args) {
+    size_type index = pos - arr_;
+    if (size_ == capacity_ && is_reallocatable(increasing_vector_capacity())) {
+        // mremap может перенести буфер, поэтому элемент из args создается до переотображения
+        value_type value(std::forward<Args>(args)...);
+        reallocate_vector(increasing_vector_capacity());
+        shift_vector_elements(index, 1);
+        new (arr_ + index) value_type(std::move(value));
+    } else if (size_ == capacity_) {
+        // Новый элемент создается в новом хранилище до переноса старых, поэтому args
+        // могут ссылаться на элементы самого вектора
+        size_type n = increasing_vector_capacity();
+        value_type *buff = allocate_storage(n);
+        try {
+            new (buff + index) value_type(std::forward<Args>(args)...);
+        } catch (...) {
+            release_storage(buff, n);
+            throw;
+        }
+        move_vector_elements(buff, n, index, 1, true);
+    } else if (index == size_) {
+        new (arr_ + size_) value_type(std::forward<Args>(args)...);
+    } else {
+        // Сдвиг хвоста перемещает элементы, на которые могут ссылаться args
+        value_type value(std::forward<Args>(args)...);
+        shift_vector_elements(index, 1);
+        new (arr_ + index) value_type(std::move(value));
     }
-    return result;
+    ++size_;
+    return arr_ + index;
 }
 
-template <typename value_type>
+template <typename value_type, class Storage, class Growth>
 template <class... Args>
-void vector<value_type>::emplace_back(Args &&...args) {
-    const auto arg_vector = {args...};
-    for (auto value = arg_vector.begin(); value != arg_vector.end(); ++value) {
-        push_back(*value);
-    }
+typename vector<value_type, Storage, Growth>::reference vector<value_type, Storage, Growth>::emplace_back(
+    Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
 }
 
 }  // namespace s21
@@ -0,0 +1,63 @@
+#ifndef S21_CONTAINERS_S21_VECTOR_GROWTH_HPP
+#define S21_CONTAINERS_S21_VECTOR_GROWTH_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+#include "s21_vector_storage.hpp"
+
+namespace s21 {
+
+// Политика роста и сжатия емкости s21::vector.
+// grow(capacity, required, element_size) - новая емкость, когда в текущую не помещается required
+// элементов; вектор берет не меньше required и не больше max_size().
+// shrink(size, capacity) - емкость после удаления элементов (erase, erase_if, pop_back); значение
+// не меньше capacity оставляет буфер как есть. clear() и shrink_to_fit() политику не спрашивают.
+
+// Рост в Num/Den раза, не меньше чем на один элемент. Множитель 1.5 позволяет аллокатору
+// со временем сложить новый буфер из освобожденных предыдущих, 2 дает меньше переносов
+template <std::size_t Num, std::size_t Den>
+struct factor_growth {
+    static_assert(Num > Den && Den > 0, "Growth factor must be greater than one");
+
+    static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t element_size);
+    static std::size_t shrink(std::size_t size, std::size_t capacity);  // Не сжимает
+};
+
+// Емкость ровно под required элементов: минимум памяти, но каждое добавление сверх емкости
+// переносит вектор, поэтому подходит для заполнения после reserve() и редких вставок
+struct exact_growth {
+    static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t element_size);
+    static std::size_t shrink(std::size_t size, std::size_t capacity);  // Не сжимает
+};
+
+// Емкость Growth, округленная вверх до целого числа страниц: буфер занимает страницы целиком,
+// и хвост последней страницы не пропадает. Элементы больше страницы не округляются
+template <class Growth>
+struct page_rounded_growth {
+    static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t element_size);
+    static std::size_t shrink(std::size_t size, std::size_t capacity);  // Как у Growth
+};
+
+// Рост как у Growth и автоматическое сжатие с гистерезисом: когда заполнено не больше 1/Divisor
+// емкости, буфер уменьшается до двойного размера. Между порогами остается запас, поэтому
+// чередование push_back и pop_back на границе не переносит вектор каждый раз
+template <class Growth, std::size_t Divisor = 4>
+struct shrinking_growth {
+    static_assert(Divisor > 2, "Shrink threshold must leave room between growth and shrink");
+
+    static std::size_t grow(std::size_t capacity, std::size_t required, std::size_t element_size);
+    static std::size_t shrink(std::size_t size,
+                              std::size_t capacity);  // 2 * size при size <= capacity / Divisor
+};
+
+using doubling_growth = factor_growth<2, 1>;
+using half_growth = factor_growth<3, 2>;  // Рост в 1.5 раза
+using page_growth = page_rounded_growth<doubling_growth>;
+using default_vector_growth = doubling_growth;
+
+}  // namespace s21
+
+#include "s21_vector_growth.inl"
+
+#endif  // S21_CONTAINERS_S21_VECTOR_GROWTH_HPP
@@ -0,0 +1,52 @@
+#include "s21_vector_growth.hpp"
+
+namespace s21 {
+
+template <std::size_t Num, std::size_t Den>
+std::size_t factor_growth<Num, Den>::grow(std::size_t capacity, std::size_t required, std::size_t) {
+    std::size_t grown = capacity + std::max<std::size_t>(capacity / Den * (Num - Den), 1);
+    return std::max(grown, required);
+}
+
+template <std::size_t Num, std::size_t Den>
+std::size_t factor_growth<Num, Den>::shrink(std::size_t, std::size_t capacity) {
+    return capacity;
+}
+
+inline std::size_t exact_growth::grow(std::size_t, std::size_t required, std::size_t) {
+    return required;
+}
+
+inline std::size_t exact_growth::shrink(std::size_t, std::size_t capacity) {
+    return capacity;
+}
+
+template <class Growth>
+std::size_t page_rounded_growth<Growth>::grow(std::size_t capacity, std::size_t required,
+                                              std::size_t element_size) {
+    std::size_t n = Growth::grow(capacity, required, element_size);
+    if (element_size == 0 || element_size > page_size || n > std::size_t(-1) / element_size - page_size) {
+        return n;
+    }
+    std::size_t bytes = (n * element_size + page_size - 1) / page_size * page_size;
+    return bytes / element_size;
+}
+
+template <class Growth>
+std::size_t page_rounded_growth<Growth>::shrink(std::size_t size, std::size_t capacity) {
+    return Growth::shrink(size, capacity);
+}
+
+template <class Growth, std::size_t Divisor>
+std::size_t shrinking_growth<Growth, Divisor>::grow(std::size_t capacity, std::size_t required,
+                                                    std::size_t element_size) {
+    return Growth::grow(capacity, required, element_size);
+}
+
+template <class Growth, std::size_t Divisor>
+std::size_t shrinking_growth<Growth, Divisor>::shrink(std::size_t size, std::size_t capacity) {
+    if (size > capacity / Divisor) return Growth::shrink(size, capacity);
+    return size * 2;
+}
+
+}  // namespace s21
@@ -0,0 +1,43 @@
+#ifndef S21_CONTAINERS_S21_VECTOR_RELOCATION_HPP
+#define S21_CONTAINERS_S21_VECTOR_RELOCATION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+namespace detail {
+
+// Перенос элементов непрерывного буфера, общий для s21::vector и s21::small_vector. Trivially
+// copyable элементы переносятся memcpy/memmove, остальные поэлементно. Функции не выделяют и не
+// освобождают память: владение буферами остается у контейнера
+
+// Переносит size элементов src в dst, оставляя count слотов с позиции gap, и разрушает src. Если
+// перемещение может бросить, элементы копируются; при исключении созданные в dst элементы (и слоты
+// gap, если filled - они уже заняты) разрушаются, src остается нетронутым, исключение пробрасывается
+template <class T>
+void relocate_elements(T *dst, T *src, std::size_t size, std::size_t gap, std::size_t count, bool filled);
+
+// Сдвигает элементы [index, size) на count слотов вправо
+template <class T>
+void shift_elements(T *data, std::size_t index, std::size_t size, std::size_t count);
+
+// Сдвигает элементы [index + count, size + count) на пустые слоты [index, index + count)
+template <class T>
+void close_gap(T *data, std::size_t index, std::size_t size, std::size_t count);
+
+// Создает элементы в пустых слотах [index, index + count) вызовом construct(slot). При исключении
+// созданные элементы разрушаются, а хвост возвращается на место
+template <class T, class Construct>
+void fill_gap(T *data, std::size_t index, std::size_t size, std::size_t count, Construct construct);
+
+}  // namespace detail
+
+}  // namespace s21
+
+#include "s21_vector_relocation.inl"
+
+#endif  // S21_CONTAINERS_S21_VECTOR_RELOCATION_HPP
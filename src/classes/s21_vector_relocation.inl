@@ -0,0 +1,65 @@
+#include "s21_vector_relocation.hpp"
+
+namespace s21 {
+
+namespace detail {
+
+template <class T>
+void relocate_elements(T *dst, T *src, std::size_t size, std::size_t gap, std::size_t count, bool filled) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (gap > 0) std::memcpy(dst, src, gap * sizeof(T));
+        if (size > gap) std::memcpy(dst + gap + count, src + gap, (size - gap) * sizeof(T));
+    } else {
+        std::size_t i = 0;
+        try {
+            for (; i < size; ++i) {
+                new (dst + i + (i >= gap ? count : 0)) T(std::move_if_noexcept(src[i]));
+            }
+        } catch (...) {
+            while (i-- > 0) dst[i + (i >= gap ? count : 0)].~T();
+            for (std::size_t j = 0; filled && j < count; ++j) dst[gap + j].~T();
+            throw;
+        }
+        for (i = 0; i < size; ++i) src[i].~T();
+    }
+}
+
+template <class T>
+void shift_elements(T *data, std::size_t index, std::size_t size, std::size_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(data + index + count, data + index, (size - index) * sizeof(T));
+    } else {
+        for (std::size_t i = size; i-- > index;) {
+            new (data + i + count) T(std::move(data[i]));
+            data[i].~T();
+        }
+    }
+}
+
+template <class T>
+void close_gap(T *data, std::size_t index, std::size_t size, std::size_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(data + index, data + index + count, (size - index) * sizeof(T));
+    } else {
+        for (std::size_t i = index; i < size; ++i) {
+            new (data + i) T(std::move(data[i + count]));
+            data[i + count].~T();
+        }
+    }
+}
+
+template <class T, class Construct>
+void fill_gap(T *data, std::size_t index, std::size_t size, std::size_t count, Construct construct) {
+    std::size_t i = index;
+    try {
+        for (; i < index + count; ++i) construct(data + i);
+    } catch (...) {
+        while (i-- > index) data[i].~T();
+        close_gap(data, index, size, count);
+        throw;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace s21
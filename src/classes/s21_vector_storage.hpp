@@ -0,0 +1,89 @@
+#ifndef S21_CONTAINERS_S21_VECTOR_STORAGE_HPP
+#define S21_CONTAINERS_S21_VECTOR_STORAGE_HPP
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+namespace s21 {
+
+constexpr std::size_t huge_page_size = 2 << 20;  // Размер прозрачной huge page на x86-64
+constexpr std::size_t page_size = 4096;           // Размер обычной страницы и выравнивание mmap
+
+// Политика выделения буфера s21::vector.
+// Alignment - выравнивание data() в байтах (степень двойки, 0 - alignof(T)): 64 дает начало буфера
+// на границе кэш-линии и AVX-512 регистра.
+// HugePageThreshold - буферы не меньше этого числа байт выравниваются на huge_page_size, округляются
+// до целого числа huge page и помечаются madvise(MADV_HUGEPAGE), чтобы ядро отображало их страницами
+// по 2 МБ и TLB покрывал весь буфер. 0 отключает режим.
+// MremapThreshold - буферы не меньше этого числа байт берутся прямо у ядра через mmap, и рост
+// trivially copyable вектора переотображает их mremap(MREMAP_MAYMOVE) без копирования элементов
+// и без второго буфера на время переноса. Не действует для буферов с выравниванием больше страницы
+// и там, где нет mremap. 0 отключает режим
+template <std::size_t Alignment = 0, std::size_t HugePageThreshold = 0,
+          std::size_t MremapThreshold = std::size_t(64) << 20>
+struct vector_storage {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    static void *allocate(std::size_t bytes, std::size_t align);  // Выделяет bytes байт с выравниванием
+    static void deallocate(void *ptr, std::size_t bytes,
+                           std::size_t align);  // Освобождает буфер, выделенный allocate(bytes, align)
+    static bool can_reallocate(std::size_t old_bytes, std::size_t new_bytes,
+                               std::size_t align);  // reallocate перенесет буфер без копирования
+    static void *reallocate(void *ptr, std::size_t old_bytes, std::size_t new_bytes,
+                            std::size_t align);  // Меняет размер буфера, сохраняя первые old_bytes байт
+
+ private:
+    static std::size_t storage_alignment(std::size_t bytes, std::size_t align);  // Итоговое выравнивание
+    static std::size_t storage_bytes(std::size_t bytes);  // Размер с учетом округления до страниц
+    static bool is_mapped(std::size_t bytes, std::size_t align);  // Буфер выделяется через mmap
+};
+
+// Политика, возвращающая освобожденные буферы в кэш потока вместо кучи. Размеры округляются вверх
+// до степени двойки, и буфер того же класса отдается следующему allocate на этом же потоке, так что
+// короткоживущие векторы после прогрева не обращаются к malloc. В каждом классе хранится не больше
+// CachedPerClass буферов, буферы больше MaxBytes и с выравниванием больше стандартного не кэшируются.
+// Кэш освобождается при завершении потока
+template <std::size_t CachedPerClass = 8, std::size_t MaxBytes = 64 << 20>
+struct recycling_vector_storage {
+    static_assert((MaxBytes & (MaxBytes - 1)) == 0, "MaxBytes must be a power of two");
+
+    static void *allocate(std::size_t bytes, std::size_t align);  // Берет буфер из кэша или из кучи
+    static void deallocate(void *ptr, std::size_t bytes,
+                           std::size_t align);  // Возвращает буфер в кэш, если в классе есть место
+    static bool can_reallocate(std::size_t old_bytes, std::size_t new_bytes,
+                               std::size_t align);  // Всегда false: буферы переносятся копированием
+    static void *reallocate(void *ptr, std::size_t old_bytes, std::size_t new_bytes, std::size_t align);
+    static std::size_t cached();                // Число буферов в кэше текущего потока
+    static void release_cache();                // Освобождает все буферы кэша текущего потока
+
+ private:
+    static constexpr std::size_t min_class_ = 4;  // Наименьший класс - 16 байт
+    static constexpr std::size_t classes_ = 64;
+
+    struct cache {
+        void *buffers[classes_][CachedPerClass ? CachedPerClass : 1];
+        std::size_t counts[classes_] = {};
+        ~cache();
+    };
+
+    static cache &thread_cache();                   // Кэш текущего потока
+    static std::size_t size_class(std::size_t bytes);  // Номер класса: log2 округленного размера
+    static bool is_cacheable(std::size_t bytes, std::size_t align);  // Буфер проходит через кэш
+};
+
+using default_vector_storage = vector_storage<>;
+template <std::size_t Alignment>
+using aligned_vector_storage = vector_storage<Alignment>;
+template <std::size_t Alignment = 64, std::size_t HugePageThreshold = huge_page_size>
+using huge_page_vector_storage = vector_storage<Alignment, HugePageThreshold>;
+using copying_vector_storage = vector_storage<0, 0, 0>;  // Без mmap: рост всегда копирует элементы
+
+}  // namespace s21
+
+#include "s21_vector_storage.inl"
+
+#endif  // S21_CONTAINERS_S21_VECTOR_STORAGE_HPP
@@ -0,0 +1,180 @@
+#include "s21_vector_storage.hpp"
+
+namespace s21 {
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+void *vector_storage<Alignment, HugePageThreshold, MremapThreshold>::allocate(std::size_t bytes,
+                                                                              std::size_t align) {
+    align = storage_alignment(bytes, align);
+    bytes = storage_bytes(bytes);
+    if (is_mapped(bytes, align)) {
+        void *ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) throw std::bad_alloc();
+        return ptr;
+    }
+    if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator new(bytes);
+    void *ptr = ::operator new(bytes, std::align_val_t(align));
+#ifdef MADV_HUGEPAGE
+    // Совет, а не требование: без поддержки THP буфер остается на обычных страницах
+    if (HugePageThreshold && bytes >= HugePageThreshold) ::madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+    return ptr;
+}
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+void vector_storage<Alignment, HugePageThreshold, MremapThreshold>::deallocate(void *ptr, std::size_t bytes,
+                                                                               std::size_t align) {
+    if (ptr == nullptr) return;
+    align = storage_alignment(bytes, align);
+    bytes = storage_bytes(bytes);
+    if (is_mapped(bytes, align)) {
+        ::munmap(ptr, bytes);
+    } else if (align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(ptr);
+    } else {
+        ::operator delete(ptr, std::align_val_t(align));
+    }
+}
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+bool vector_storage<Alignment, HugePageThreshold, MremapThreshold>::can_reallocate(std::size_t old_bytes,
+                                                                                  std::size_t new_bytes,
+                                                                                  std::size_t align) {
+    return is_mapped(storage_bytes(old_bytes), storage_alignment(old_bytes, align)) &&
+           is_mapped(storage_bytes(new_bytes), storage_alignment(new_bytes, align));
+}
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+void *vector_storage<Alignment, HugePageThreshold, MremapThreshold>::reallocate(
+    void *ptr, std::size_t old_bytes, std::size_t new_bytes, std::size_t align) {
+#ifdef MREMAP_MAYMOVE
+    if (can_reallocate(old_bytes, new_bytes, align)) {
+        // Ядро переносит таблицы страниц, физические страницы остаются на месте
+        void *buff = ::mremap(ptr, storage_bytes(old_bytes), storage_bytes(new_bytes), MREMAP_MAYMOVE);
+        if (buff == MAP_FAILED) throw std::bad_alloc();
+        return buff;
+    }
+#endif
+    void *buff = allocate(new_bytes, align);
+    std::memcpy(buff, ptr, std::min(old_bytes, new_bytes));
+    deallocate(ptr, old_bytes, align);
+    return buff;
+}
+
+// private
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+std::size_t vector_storage<Alignment, HugePageThreshold, MremapThreshold>::storage_alignment(
+    std::size_t bytes, std::size_t align) {
+    align = std::max(align, Alignment);
+    if (HugePageThreshold && bytes >= HugePageThreshold) align = std::max(align, huge_page_size);
+    return align;
+}
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+std::size_t vector_storage<Alignment, HugePageThreshold, MremapThreshold>::storage_bytes(
+    std::size_t bytes) {
+    if (HugePageThreshold && bytes >= HugePageThreshold) {
+        bytes = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    } else if (MremapThreshold && bytes >= MremapThreshold) {
+        bytes = (bytes + page_size - 1) / page_size * page_size;
+    }
+    return bytes;
+}
+
+template <std::size_t Alignment, std::size_t HugePageThreshold, std::size_t MremapThreshold>
+bool vector_storage<Alignment, HugePageThreshold, MremapThreshold>::is_mapped(std::size_t bytes,
+                                                                             std::size_t align) {
+#ifdef MREMAP_MAYMOVE
+    return MremapThreshold && bytes >= MremapThreshold && align <= page_size;
+#else
+    static_cast<void>(bytes);
+    static_cast<void>(align);
+    return false;
+#endif
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+void *recycling_vector_storage<CachedPerClass, MaxBytes>::allocate(std::size_t bytes, std::size_t align) {
+    if (!is_cacheable(bytes, align)) return vector_storage<>::allocate(bytes, align);
+    std::size_t index = size_class(bytes);
+    cache &c = thread_cache();
+    if (c.counts[index] > 0) return c.buffers[index][--c.counts[index]];
+    return ::operator new(std::size_t(1) << index);
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+void recycling_vector_storage<CachedPerClass, MaxBytes>::deallocate(void *ptr, std::size_t bytes,
+                                                                    std::size_t align) {
+    if (ptr == nullptr) return;
+    if (!is_cacheable(bytes, align)) return vector_storage<>::deallocate(ptr, bytes, align);
+    std::size_t index = size_class(bytes);
+    cache &c = thread_cache();
+    if (c.counts[index] < CachedPerClass) {
+        c.buffers[index][c.counts[index]++] = ptr;
+    } else {
+        ::operator delete(ptr);
+    }
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+bool recycling_vector_storage<CachedPerClass, MaxBytes>::can_reallocate(std::size_t, std::size_t,
+                                                                        std::size_t) {
+    return false;
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+void *recycling_vector_storage<CachedPerClass, MaxBytes>::reallocate(void *ptr, std::size_t old_bytes,
+                                                                     std::size_t new_bytes,
+                                                                     std::size_t align) {
+    void *buff = allocate(new_bytes, align);
+    std::memcpy(buff, ptr, std::min(old_bytes, new_bytes));
+    deallocate(ptr, old_bytes, align);
+    return buff;
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+std::size_t recycling_vector_storage<CachedPerClass, MaxBytes>::cached() {
+    cache &c = thread_cache();
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < classes_; ++i) result += c.counts[i];
+    return result;
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+void recycling_vector_storage<CachedPerClass, MaxBytes>::release_cache() {
+    cache &c = thread_cache();
+    for (std::size_t i = 0; i < classes_; ++i) {
+        for (; c.counts[i] > 0; --c.counts[i]) ::operator delete(c.buffers[i][c.counts[i] - 1]);
+    }
+}
+
+// private
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+recycling_vector_storage<CachedPerClass, MaxBytes>::cache::~cache() {
+    for (std::size_t i = 0; i < classes_; ++i) {
+        for (std::size_t j = 0; j < counts[i]; ++j) ::operator delete(buffers[i][j]);
+    }
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+typename recycling_vector_storage<CachedPerClass, MaxBytes>::cache &
+recycling_vector_storage<CachedPerClass, MaxBytes>::thread_cache() {
+    thread_local cache c;
+    return c;
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+std::size_t recycling_vector_storage<CachedPerClass, MaxBytes>::size_class(std::size_t bytes) {
+    if (bytes <= (std::size_t(1) << min_class_)) return min_class_;
+    return 64 - __builtin_clzll(static_cast<unsigned long long>(bytes - 1));
+}
+
+template <std::size_t CachedPerClass, std::size_t MaxBytes>
+bool recycling_vector_storage<CachedPerClass, MaxBytes>::is_cacheable(std::size_t bytes,
+                                                                      std::size_t align) {
+    return bytes <= MaxBytes && align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+}  // namespace s21
@@ -4,5 +4,15 @@
 #include "classes/s21_set.hpp"
 #include "classes/s21_stack.hpp"
 #include "classes/s21_vector.hpp"
+#include "classes/s21_small_vector.hpp"
+#include "classes/s21_mmap_vector.hpp"
+#include "classes/s21_simd.hpp"
+#include "classes/s21_dynamic_bitset.hpp"
+#include "classes/s21_soa_vector.hpp"
+#include "classes/s21_concurrent_vector.hpp"
+#include "classes/s21_concurrent_queue.hpp"
+#include "classes/s21_unrolled_list.hpp"
+#include "classes/s21_intrusive_list.hpp"
+#include "classes/s21_parallel.hpp"
 #include "classes/s21_array.hpp"
 #include "classes/s21_multiset.hpp"
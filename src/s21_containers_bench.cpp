@@ -0,0 +1,33 @@
+#include <cstdlib>
+#include <new>
+
+#include "benchmarks/s21_concurrent_queue_bench.cpp"
+#include "benchmarks/s21_concurrent_vector_bench.cpp"
+#include "benchmarks/s21_dynamic_bitset_bench.cpp"
+#include "benchmarks/s21_intrusive_list_bench.cpp"
+#include "benchmarks/s21_list_bench.cpp"
+#include "benchmarks/s21_mmap_vector_bench.cpp"
+#include "benchmarks/s21_parallel_bench.cpp"
+#include "benchmarks/s21_simd_bench.cpp"
+#include "benchmarks/s21_small_vector_bench.cpp"
+#include "benchmarks/s21_soa_vector_bench.cpp"
+#include "benchmarks/s21_unrolled_list_bench.cpp"
+#include "benchmarks/s21_vector_bench.cpp"
+
+std::atomic<size_t> s21_bench::allocations{0};
+
+void *operator new(size_t size) {
+  s21_bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+// noinline: иначе GCC видит free() в паре с operator new и выдает -Wmismatched-new-delete
+__attribute__((noinline)) void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+__attribute__((noinline)) void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+GTEST_API_ int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
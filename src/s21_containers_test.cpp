@@ -1,3 +1,6 @@
+#include <cstdlib>
+#include <new>
+
 #include "tests/s21_rbtree_test.cpp"
 
 #include "tests/s21_list_test.cpp"
@@ -6,9 +9,38 @@
 #include "tests/s21_set_test.cpp"
 #include "tests/s21_stack_test.cpp"
 #include "tests/s21_vector_test.cpp"
+#include "tests/s21_small_vector_test.cpp"
+#include "tests/s21_mmap_vector_test.cpp"
+#include "tests/s21_simd_test.cpp"
+#include "tests/s21_dynamic_bitset_test.cpp"
+#include "tests/s21_soa_vector_test.cpp"
+#include "tests/s21_concurrent_vector_test.cpp"
+#include "tests/s21_concurrent_queue_test.cpp"
+#include "tests/s21_unrolled_list_test.cpp"
+#include "tests/s21_intrusive_list_test.cpp"
+#include "tests/s21_parallel_test.cpp"
 #include "tests/s21_array_test.cpp"
 #include "tests/s21_multiset_test.cpp"
 
+std::atomic<size_t> s21_test::allocations{0};
+
+void *operator new(size_t size) {
+  s21_test::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+// Через nothrow-версию std::stable_sort берет временный буфер, освобождаемый operator delete выше
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  s21_test::allocations.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size ? size : 1);
+}
+
+// noinline: иначе GCC видит free() в паре с operator new и выдает -Wmismatched-new-delete
+__attribute__((noinline)) void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+__attribute__((noinline)) void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
 GTEST_API_ int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
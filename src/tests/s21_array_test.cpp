@@ -4,6 +4,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <string>
 
 TEST(s21_array_case, array1) {
     s21::Array<int, 3> arr1;
@@ -102,3 +103,11 @@ TEST(s21_array_case, array9) {
     arr1.fill(100);
     for (std::size_t i = 0; i < arr1.size(); i++) ASSERT_EQ(arr1[i], 100);
 }
+
+TEST(s21_array_case, array10) {
+    s21::Array<std::string, 3> arr1{"first", "second", "third"};
+    s21::Array<std::string, 3> arr2(arr1);
+    s21::Array<std::string, 3> arr3(std::move(arr1));
+    for (std::size_t i = 0; i < arr2.size(); i++) ASSERT_EQ(arr2[i], arr3[i]);
+    ASSERT_EQ(arr3[1], "second");
+}
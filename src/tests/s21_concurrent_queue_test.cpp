@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>  // NOLINT(build/c++11)
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "../classes/s21_concurrent_queue.hpp"
+
+TEST(s21_concurrent_queue_case, push_pop) {
+    s21::concurrent_queue<std::string> queue(5);
+    ASSERT_EQ(queue.capacity(), 8u);
+    ASSERT_TRUE(queue.empty());
+    std::string value;
+    ASSERT_FALSE(queue.try_pop(value));
+    for (int i = 0; i < 8; ++i) ASSERT_TRUE(queue.try_push(std::to_string(i)));
+    ASSERT_EQ(queue.size(), 8u);
+    const std::string extra("extra");
+    ASSERT_FALSE(queue.try_push(extra));
+    // Несколько кругов по кольцу сохраняют порядок
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, std::to_string(i));
+        ASSERT_TRUE(queue.try_push(std::to_string(i + 8)));
+    }
+    ASSERT_EQ(queue.size(), 8u);
+    ASSERT_THROW(s21::concurrent_queue<int>(0), std::invalid_argument);
+}
+
+TEST(s21_concurrent_queue_case, batches) {
+    s21::concurrent_queue<std::unique_ptr<int>> queue(8);
+    std::vector<std::unique_ptr<int>> input;
+    for (int i = 0; i < 10; ++i) input.push_back(std::make_unique<int>(i));
+    // В очередь помещается только 8 элементов из 10
+    ASSERT_EQ(queue.push_n(input.begin(), input.size()), 8u);
+    ASSERT_EQ(input[0], nullptr);
+    ASSERT_NE(input[8], nullptr);
+    std::vector<std::unique_ptr<int>> output;
+    ASSERT_EQ(queue.pop_n(std::back_inserter(output), 3), 3u);
+    ASSERT_EQ(queue.push_n(input.begin() + 8, 2), 2u);
+    ASSERT_EQ(queue.pop_n(std::back_inserter(output), 100), 7u);
+    ASSERT_EQ(queue.pop_n(std::back_inserter(output), 100), 0u);
+    ASSERT_EQ(output.size(), 10u);
+    for (int i = 0; i < 10; ++i) ASSERT_EQ(*output[i], i);
+}
+
+TEST(s21_concurrent_queue_case, destroys_remaining) {
+    auto counter = std::make_shared<int>(0);
+    {
+        s21::concurrent_queue<std::shared_ptr<int>> queue(16);
+        for (int i = 0; i < 10; ++i) queue.try_push(counter);
+        std::shared_ptr<int> value;
+        queue.try_pop(value);
+        ASSERT_EQ(counter.use_count(), 11);
+    }
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(s21_concurrent_queue_case, producers_consumers) {
+    // Каждое значение должно быть получено ровно один раз, а значения одного производителя - по порядку
+    const int producers = 4, consumers = 4, per_producer = 20000;
+    s21::concurrent_queue<int> queue(64);
+    std::vector<std::atomic<int>> received(producers * per_producer);
+    for (auto &flag : received) flag.store(0);
+    std::atomic<int> consumed(0);
+    std::atomic<bool> ordered(true);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            int batch[8];
+            for (int i = 0; i < per_producer;) {
+                if (i % 3 == 0) {
+                    int n = std::min(8, per_producer - i);
+                    for (int k = 0; k < n; ++k) batch[k] = p * per_producer + i + k;
+                    int pushed = static_cast<int>(queue.push_n(batch, n));
+                    i += pushed;
+                    if (!pushed) std::this_thread::yield();
+                } else if (queue.try_push(p * per_producer + i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<int> last(producers, -1);
+            int batch[8];
+            while (consumed.load() < producers * per_producer) {
+                int n = static_cast<int>(queue.pop_n(batch, 8));
+                if (!n) std::this_thread::yield();
+                for (int k = 0; k < n; ++k) {
+                    int producer = batch[k] / per_producer;
+                    if (batch[k] <= last[producer]) ordered = false;
+                    last[producer] = batch[k];
+                    received[batch[k]].fetch_add(1);
+                }
+                consumed.fetch_add(n);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(queue.empty());
+    for (auto &flag : received) ASSERT_EQ(flag.load(), 1);
+}
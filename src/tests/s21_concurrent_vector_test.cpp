@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>  // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "../classes/s21_concurrent_vector.hpp"
+
+// Счетчик вызовов глобального operator new, определен в s21_containers_test.cpp
+namespace s21_test {
+extern std::atomic<size_t> allocations;
+}
+
+TEST(s21_concurrent_vector_case, push_back) {
+    s21::concurrent_vector<std::string> vector;
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), 0u);
+    for (int i = 0; i < 1000; ++i) ASSERT_EQ(vector.push_back(std::to_string(i)), static_cast<size_t>(i));
+    ASSERT_EQ(vector.size(), 1000u);
+    ASSERT_GE(vector.capacity(), 1000u);
+    for (int i = 0; i < 1000; ++i) ASSERT_EQ(vector[i], std::to_string(i));
+    ASSERT_EQ(vector.at(999), "999");
+    ASSERT_THROW(vector.at(1000), std::out_of_range);
+    ASSERT_TRUE(vector.is_published(0));
+    ASSERT_FALSE(vector.is_published(1000));
+    std::string value("moved");
+    size_t pos = vector.push_back(std::move(value));
+    ASSERT_EQ(vector[pos], "moved");
+    pos = vector.emplace_back(3, 'x');
+    ASSERT_EQ(vector[pos], "xxx");
+}
+
+TEST(s21_concurrent_vector_case, stable_addresses) {
+    s21::concurrent_vector<int> vector;
+    vector.push_back(42);
+    int *first = &vector[0];
+    for (int i = 0; i < 100000; ++i) vector.push_back(i);
+    ASSERT_EQ(&vector[0], first);
+    ASSERT_EQ(*first, 42);
+}
+
+TEST(s21_concurrent_vector_case, reads_without_allocations) {
+    // Чтение только загружает указатель сегмента и не выделяет еще не созданные сегменты
+    s21::concurrent_vector<int> vector;
+    for (int i = 0; i < 1000; ++i) vector.push_back(i);
+    size_t capacity = vector.capacity();
+    size_t allocations = s21_test::allocations;
+    int64_t sum = 0;
+    for (int i = 0; i < 1000; ++i) sum += vector[i] + vector.at(i);
+    ASSERT_FALSE(vector.is_published(size_t(1) << 20));
+    ASSERT_EQ(s21_test::allocations, allocations);
+    ASSERT_EQ(sum, 999000);
+    // Сообщение исключения выделяет память, поэтому здесь проверяется только емкость
+    ASSERT_THROW(vector.at(size_t(1) << 20), std::out_of_range);
+    ASSERT_EQ(vector.capacity(), capacity);
+}
+
+TEST(s21_concurrent_vector_case, reserve_and_clear) {
+    s21::concurrent_vector<std::string> vector;
+    vector.reserve(100);
+    size_t capacity = vector.capacity();
+    ASSERT_GE(capacity, 100u);
+    for (int i = 0; i < 100; ++i) vector.push_back("item");
+    ASSERT_EQ(vector.capacity(), capacity);
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), capacity);
+    ASSERT_FALSE(vector.is_published(0));
+    vector.push_back("again");
+    ASSERT_EQ(vector[0], "again");
+}
+
+TEST(s21_concurrent_vector_case, concurrent_push_back) {
+    const int threads = 8;
+    const int per_thread = 20000;
+    s21::concurrent_vector<int> vector;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&vector, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                size_t pos = vector.push_back(t * per_thread + i);
+                ASSERT_EQ(vector[pos], t * per_thread + i);
+            }
+        });
+    }
+    for (auto &worker : workers) worker.join();
+    ASSERT_EQ(vector.size(), static_cast<size_t>(threads * per_thread));
+    std::vector<int> values;
+    for (size_t i = 0; i < vector.size(); ++i) values.push_back(vector.at(i));
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < threads * per_thread; ++i) ASSERT_EQ(values[i], i);
+}
+
+TEST(s21_concurrent_vector_case, one_allocation_per_segment) {
+    // Потоки одновременно переходят границы сегментов, но каждый сегмент выделяется один раз
+    const int threads = 8;
+    const int per_thread = 4000;
+    s21::concurrent_vector<int> vector;
+    std::atomic<bool> start{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&vector, &start] {
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (int i = 0; i < per_thread; ++i) vector.push_back(i);
+        });
+    }
+    size_t allocations = s21_test::allocations;
+    start.store(true, std::memory_order_release);
+    for (auto &worker : workers) worker.join();
+    size_t segments = 0;
+    for (size_t capacity = 0; capacity < vector.capacity(); ++segments) capacity += size_t(32) << segments;
+    ASSERT_EQ(s21_test::allocations - allocations, segments);
+    ASSERT_GE(vector.capacity(), static_cast<size_t>(threads * per_thread));
+}
+
+TEST(s21_concurrent_vector_case, concurrent_readers) {
+    // Читатель видит только опубликованные элементы, пока писатель продолжает добавлять
+    s21::concurrent_vector<std::string> vector;
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 50000; ++i) vector.push_back(std::to_string(i));
+        done = true;
+    });
+    size_t checked = 0;
+    while (!done || checked < vector.size()) {
+        size_t size = vector.size();
+        for (size_t i = checked; i < size && vector.is_published(i); ++i, ++checked) {
+            ASSERT_EQ(vector[i], std::to_string(i));
+        }
+    }
+    writer.join();
+    ASSERT_EQ(checked, 50000u);
+}
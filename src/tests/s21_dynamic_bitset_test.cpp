@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "../classes/s21_dynamic_bitset.hpp"
+
+TEST(s21_dynamic_bitset_case, create) {
+    s21::dynamic_bitset bits;
+    ASSERT_TRUE(bits.empty());
+    ASSERT_EQ(bits.count(), 0u);
+    ASSERT_EQ(bits.find_first(), s21::dynamic_bitset::npos);
+
+    s21::dynamic_bitset bits2(130);
+    ASSERT_EQ(bits2.size(), 130u);
+    ASSERT_EQ(bits2.num_words(), 3u);
+    ASSERT_TRUE(bits2.none());
+
+    s21::dynamic_bitset bits3(130, true);
+    ASSERT_EQ(bits3.count(), 130u);
+    ASSERT_TRUE(bits3.all());
+    ASSERT_EQ(bits3.data()[2], 3u);
+}
+
+TEST(s21_dynamic_bitset_case, set_reset_test) {
+    s21::dynamic_bitset bits(200);
+    bits.set(0).set(63).set(64).set(199);
+    ASSERT_TRUE(bits.test(0));
+    ASSERT_TRUE(bits[63]);
+    ASSERT_TRUE(bits[64]);
+    ASSERT_FALSE(bits[65]);
+    ASSERT_TRUE(bits.test(199));
+    ASSERT_EQ(bits.count(), 4u);
+    bits.reset(63);
+    bits.set(64, false);
+    ASSERT_EQ(bits.count(), 2u);
+    bits.flip(5);
+    ASSERT_TRUE(bits[5]);
+    bits.flip();
+    ASSERT_EQ(bits.count(), 197u);
+    bits.reset();
+    ASSERT_TRUE(bits.none());
+    ASSERT_THROW(bits.test(200), std::out_of_range);
+    ASSERT_THROW(bits.set(200), std::out_of_range);
+    ASSERT_THROW(bits.flip(1000), std::out_of_range);
+}
+
+TEST(s21_dynamic_bitset_case, resize_and_push_back) {
+    s21::dynamic_bitset bits;
+    for (int i = 0; i < 100; ++i) bits.push_back(i % 3 == 0);
+    ASSERT_EQ(bits.size(), 100u);
+    ASSERT_EQ(bits.count(), 34u);
+    bits.resize(150, true);
+    ASSERT_EQ(bits.count(), 84u);
+    ASSERT_TRUE(bits[99] == true);
+    ASSERT_TRUE(bits[100]);
+    ASSERT_TRUE(bits[149]);
+    bits.resize(10);
+    ASSERT_EQ(bits.count(), 4u);
+    bits.resize(70);
+    ASSERT_EQ(bits.count(), 4u);
+    bits.resize(64, true);
+    ASSERT_EQ(bits.num_words(), 1u);
+    bits.clear();
+    ASSERT_TRUE(bits.empty());
+    ASSERT_EQ(bits.num_words(), 0u);
+}
+
+TEST(s21_dynamic_bitset_case, bulk_operations) {
+    s21::dynamic_bitset a(300);
+    s21::dynamic_bitset b(300);
+    for (size_t i = 0; i < 300; i += 2) a.set(i);
+    for (size_t i = 0; i < 300; i += 3) b.set(i);
+    s21::dynamic_bitset and_bits(a);
+    and_bits &= b;
+    ASSERT_EQ(and_bits.count(), 50u);
+    s21::dynamic_bitset or_bits(a);
+    or_bits |= b;
+    ASSERT_EQ(or_bits.count(), 200u);
+    s21::dynamic_bitset xor_bits(a);
+    xor_bits ^= b;
+    ASSERT_EQ(xor_bits.count(), 150u);
+    s21::dynamic_bitset andnot_bits(a);
+    andnot_bits.and_not(b);
+    ASSERT_EQ(andnot_bits.count(), 100u);
+    ASSERT_FALSE(andnot_bits[6]);
+    ASSERT_TRUE(andnot_bits[4]);
+    ASSERT_FALSE(a == b);
+    s21::dynamic_bitset copy(a);
+    ASSERT_TRUE(copy == a);
+    s21::dynamic_bitset other(299);
+    ASSERT_THROW(a &= other, std::invalid_argument);
+    ASSERT_THROW(a.and_not(other), std::invalid_argument);
+}
+
+TEST(s21_dynamic_bitset_case, find_first_next) {
+    std::mt19937 gen(7);
+    for (size_t n : {1, 63, 64, 65, 1000, 4099}) {
+        s21::dynamic_bitset bits(n);
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < n; ++i) {
+            if (gen() % 17 == 0 || i == n - 1) {
+                bits.set(i);
+                expected.push_back(i);
+            }
+        }
+        std::vector<size_t> found;
+        for (size_t pos = bits.find_first(); pos != s21::dynamic_bitset::npos; pos = bits.find_next(pos)) {
+            found.push_back(pos);
+        }
+        ASSERT_EQ(found, expected);
+        ASSERT_EQ(bits.count(), expected.size());
+    }
+    s21::dynamic_bitset bits(10);
+    ASSERT_EQ(bits.find_next(s21::dynamic_bitset::npos), s21::dynamic_bitset::npos);
+    ASSERT_EQ(bits.find_next(9), s21::dynamic_bitset::npos);
+}
+
+TEST(s21_dynamic_bitset_case, move) {
+    s21::dynamic_bitset bits(100, true);
+    s21::dynamic_bitset moved(std::move(bits));
+    ASSERT_EQ(moved.count(), 100u);
+    ASSERT_TRUE(bits.empty());
+    bits = std::move(moved);
+    ASSERT_EQ(bits.size(), 100u);
+    s21::dynamic_bitset copy;
+    copy = bits;
+    ASSERT_TRUE(copy == bits);
+}
+
+TEST(s21_dynamic_bitset_case, popcount_isa) {
+    s21::dynamic_bitset bits(10000);
+    for (size_t i = 0; i < 10000; i += 7) bits.set(i);
+    for (auto isa : {s21::simd::isa::scalar, s21::simd::isa::avx2}) {
+        s21::simd::force_isa(isa);
+        ASSERT_EQ(bits.count(), 1429u);
+    }
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <atomic>  // NOLINT(build/c++11)
+#include <list>
+#include <vector>
+
+#include "../classes/s21_intrusive_list.hpp"
+
+// Счетчик вызовов глобального operator new, определен в s21_containers_test.cpp
+namespace s21_test {
+extern std::atomic<size_t> allocations;
+}
+
+struct intrusive_item {
+    int id;
+    int key;
+    s21::intrusive_list_hook hook;
+    s21::intrusive_list_hook timer_hook;
+
+    explicit intrusive_item(int i = 0, int k = 0) : id(i), key(k) {}
+    bool operator<(const intrusive_item &other) const { return key < other.key; }
+    bool operator==(const intrusive_item &other) const { return key == other.key; }
+};
+
+using intrusive_items = s21::intrusive_list<intrusive_item, &intrusive_item::hook>;
+using intrusive_timers = s21::intrusive_list<intrusive_item, &intrusive_item::timer_hook>;
+
+template <class List>
+void compare_intrusive(List &intrusive, std::list<int> const &expected) {
+    ASSERT_EQ(intrusive.size(), expected.size());
+    auto it = intrusive.begin();
+    for (int id : expected) {
+        ASSERT_EQ(it->id, id);
+        ++it;
+    }
+    ASSERT_TRUE(it == intrusive.end());
+    for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+        --it;
+        ASSERT_EQ((*it).id, *rit);
+    }
+}
+
+TEST(s21_intrusive_list_case, link_unlink) {
+    std::vector<intrusive_item> pool;
+    for (int i = 0; i < 10; ++i) pool.emplace_back(i, i);
+    intrusive_items items;
+    ASSERT_TRUE(items.empty());
+    ASSERT_THROW(items.front(), std::out_of_range);
+    ASSERT_THROW(items.pop_back(), std::out_of_range);
+
+    for (int i = 0; i < 5; ++i) items.push_back(pool[i]);
+    for (int i = 5; i < 8; ++i) items.push_front(pool[i]);
+    compare_intrusive(items, {7, 6, 5, 0, 1, 2, 3, 4});
+    ASSERT_TRUE(pool[0].hook.is_linked());
+    ASSERT_FALSE(pool[9].hook.is_linked());
+    ASSERT_THROW(items.push_back(pool[0]), std::invalid_argument);
+
+    // Исключение из середины по самому объекту
+    items.erase(pool[1]);
+    ASSERT_FALSE(pool[1].hook.is_linked());
+    ASSERT_THROW(items.erase(pool[1]), std::invalid_argument);
+    auto it = items.erase(items.iterator_to(pool[0]));
+    ASSERT_EQ(&*it, &pool[2]);
+    it = items.insert(it, pool[9]);
+    ASSERT_EQ(it->id, 9);
+    compare_intrusive(items, {7, 6, 5, 9, 2, 3, 4});
+    items.pop_front();
+    items.pop_back();
+    compare_intrusive(items, {6, 5, 9, 2, 3});
+    ASSERT_EQ(&items.front(), &pool[6]);
+    ASSERT_EQ(&items.back(), &pool[3]);
+
+    // Копия объекта не связана, перемещенный список сохраняет объекты
+    intrusive_item copy(pool[6]);
+    ASSERT_FALSE(copy.hook.is_linked());
+    intrusive_items moved(std::move(items));
+    ASSERT_TRUE(items.empty());
+    compare_intrusive(moved, {6, 5, 9, 2, 3});
+    items = std::move(moved);
+    compare_intrusive(items, {6, 5, 9, 2, 3});
+    items.clear();
+    ASSERT_TRUE(items.empty());
+    for (auto &item : pool) ASSERT_FALSE(item.hook.is_linked());
+}
+
+TEST(s21_intrusive_list_case, two_hooks) {
+    // Один объект одновременно входит в два списка через разные звенья
+    intrusive_item a(1, 1), b(2, 2), c(3, 3);
+    intrusive_items items;
+    intrusive_timers timers;
+    items.push_back(a);
+    items.push_back(b);
+    items.push_back(c);
+    timers.push_back(c);
+    timers.push_back(a);
+    items.erase(a);
+    compare_intrusive(items, {2, 3});
+    compare_intrusive(timers, {3, 1});
+    const intrusive_timers &view = timers;
+    intrusive_timers::const_iterator cit = view.begin();
+    ASSERT_EQ(cit->id, 3);
+    ASSERT_TRUE(cit++ == view.begin());
+    ASSERT_TRUE(++cit == view.end());
+}
+
+// Полиморфный тип с базой: звено лежит после указателя на таблицу виртуальных функций и полей базы
+struct intrusive_base {
+    int base_id = 0;
+};
+
+struct intrusive_derived : intrusive_base {
+    s21::intrusive_list_hook hook;
+    int id;
+
+    explicit intrusive_derived(int i = 0) : id(i) {}
+    virtual ~intrusive_derived() = default;
+};
+
+TEST(s21_intrusive_list_case, hook_offset) {
+    std::vector<intrusive_derived> pool;
+    for (int i = 0; i < 4; ++i) pool.emplace_back(i);
+    s21::intrusive_list<intrusive_derived, &intrusive_derived::hook> items;
+    for (auto &item : pool) items.push_back(item);
+    ASSERT_EQ(&items.front(), &pool[0]);
+    ASSERT_EQ(&items.back(), &pool[3]);
+    int id = 0;
+    for (auto &item : items) ASSERT_EQ(item.id, id++);
+
+    intrusive_timers timers;
+    intrusive_item item(7, 7);
+    timers.push_back(item);
+    ASSERT_EQ(&timers.front(), &item);
+    timers.clear();
+    items.clear();
+}
+
+TEST(s21_intrusive_list_case, operations) {
+    std::vector<intrusive_item> pool;
+    for (int i = 0; i < 16; ++i) pool.emplace_back(i, 0);
+    intrusive_items first;
+    intrusive_items second;
+    int first_keys[] = {1, 3, 5, 7, 9, 11};
+    int second_keys[] = {2, 3, 4, 10};
+    for (int i = 0; i < 6; ++i) {
+        pool[i].key = first_keys[i];
+        first.push_back(pool[i]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        pool[6 + i].key = second_keys[i];
+        second.push_back(pool[6 + i]);
+    }
+    first.merge(second);
+    ASSERT_TRUE(second.empty());
+    // Равные ключи: сначала объект исходного списка
+    compare_intrusive(first, {0, 6, 1, 7, 8, 2, 3, 4, 9, 5});
+
+    for (int i = 10; i < 13; ++i) second.push_back(pool[i]);
+    first.splice(std::next(first.begin(), 2), second);
+    ASSERT_TRUE(second.empty());
+    compare_intrusive(first, {0, 6, 10, 11, 12, 1, 7, 8, 2, 3, 4, 9, 5});
+    second.splice(second.end(), first, first.iterator_to(pool[12]));
+    second.splice(second.begin(), first, first.begin(), std::next(first.begin(), 2));
+    compare_intrusive(first, {10, 11, 1, 7, 8, 2, 3, 4, 9, 5});
+    compare_intrusive(second, {0, 6, 12});
+    first.splice(first.begin(), first, std::next(first.begin(), 8), first.end());
+    compare_intrusive(first, {9, 5, 10, 11, 1, 7, 8, 2, 3, 4});
+
+    first.reverse();
+    compare_intrusive(first, {4, 3, 2, 8, 7, 1, 11, 10, 5, 9});
+    first.sort();
+    // Объекты с равными ключами сохраняют порядок
+    compare_intrusive(first, {11, 10, 7, 1, 8, 2, 3, 4, 9, 5});
+    ASSERT_EQ(first.unique(), 2);
+    ASSERT_FALSE(pool[10].hook.is_linked());
+    compare_intrusive(first, {11, 7, 8, 2, 3, 4, 9, 5});
+    auto same_fives = [](const intrusive_item &a, const intrusive_item &b) { return a.key / 5 == b.key / 5; };
+    ASSERT_EQ(first.unique(same_fives), 5);
+    compare_intrusive(first, {11, 2, 9});
+
+    first.swap(second);
+    compare_intrusive(first, {0, 6, 12});
+    compare_intrusive(second, {11, 2, 9});
+}
+
+TEST(s21_intrusive_list_case, no_allocations) {
+    std::vector<intrusive_item> pool;
+    for (int i = 0; i < 1000; ++i) pool.emplace_back(i, (i * 7919) % 1000);
+    size_t allocations = s21_test::allocations;
+    {
+        intrusive_items items;
+        intrusive_items other;
+        for (auto &item : pool) items.push_back(item);
+        for (int i = 0; i < 1000; i += 3) items.erase(pool[i]);
+        for (int i = 0; i < 1000; i += 3) other.push_front(pool[i]);
+        items.sort();
+        other.sort();
+        items.merge(other);
+        items.reverse();
+        items.splice(items.begin(), other);
+        other.splice(other.end(), items, std::next(items.begin(), 10), std::next(items.begin(), 500));
+        items.unique();
+        items.swap(other);
+        intrusive_items moved(std::move(items));
+        moved.pop_front();
+        moved.pop_back();
+    }
+    ASSERT_EQ(s21_test::allocations, allocations);
+    for (auto &item : pool) ASSERT_FALSE(item.hook.is_linked());
+}
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
 #include <list>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include <initializer_list>
 
 #include "../classes/s21_list.hpp"
@@ -195,6 +201,109 @@ TEST(s21_list_case, splice) {
     compare_lists(s21_list2, std_list2);
 }
 
+TEST(s21_list_case, splice_other_tail_to_end) {
+    s21::list <float> s21_list1{ 1, 2 };
+    s21::list <float> s21_list2{ 3, 4 };
+    std::list <float> std_list1{ 1, 2 };
+    std::list <float> std_list2{ 3, 4 };
+    s21_list1.splice(s21_list1.end(), s21_list2, ++s21_list2.begin());
+    std_list1.splice(std_list1.end(), std_list2, ++std_list2.begin());
+    compare_lists(s21_list1, std_list1);
+    compare_lists(s21_list2, std_list2);
+    ASSERT_EQ(s21_list1.size(), 3);
+    ASSERT_EQ(s21_list2.size(), 1);
+    // Последний элемент перед end() своего списка остается на месте
+    s21_list1.splice(s21_list1.end(), s21_list1, --s21_list1.end());
+    compare_lists(s21_list1, std_list1);
+}
+
+TEST(s21_list_case, splice_relinks_nodes) {
+    s21::list <float> s21_list1{ 1, 2, 3 };
+    s21::list <float> s21_list2{ 4, 5, 6, 7, 8 };
+    std::list <float> std_list1{ 1, 2, 3 };
+    std::list <float> std_list2{ 4, 5, 6, 7, 8 };
+    std::map <s21::list_item <float> *, float> nodes;
+    for (auto it = s21_list1.begin(); it != s21_list1.end(); ++it) nodes[it.ptr_] = *it;
+    for (auto it = s21_list2.begin(); it != s21_list2.end(); ++it) nodes[it.ptr_] = *it;
+    auto check_nodes = [&nodes](s21::list <float> const &l) {
+        for (auto it = l.begin(); it != l.end(); ++it) ASSERT_EQ(nodes.at(it.ptr_), *it);
+    };
+
+    // Один узел: 5 перед 2
+    auto pos1 = s21_list1.begin();
+    ++pos1;
+    auto it2 = s21_list2.begin();
+    ++it2;
+    s21_list1.splice(pos1, s21_list2, it2);
+    std_list1.splice(std::next(std_list1.begin()), std_list2, std::next(std_list2.begin()));
+    compare_lists(s21_list1, std_list1);
+    compare_lists(s21_list2, std_list2);
+    ASSERT_EQ(s21_list1.size(), 4);
+    ASSERT_EQ(s21_list2.size(), 4);
+
+    // Диапазон [6, 8) в конец
+    auto first = s21_list2.begin();
+    ++first;
+    auto last = first;
+    ++last;
+    ++last;
+    s21_list1.splice(s21_list1.end(), s21_list2, first, last);
+    std_list1.splice(std_list1.end(), std_list2, std::next(std_list2.begin()),
+                     std::next(std_list2.begin(), 3));
+    compare_lists(s21_list1, std_list1);
+    compare_lists(s21_list2, std_list2);
+    ASSERT_EQ(s21_list1.size(), 6);
+    ASSERT_EQ(s21_list1.back(), 7);
+
+    // Диапазон внутри одного списка: [1, 5) в конец
+    first = s21_list1.begin();
+    last = first;
+    ++last;
+    ++last;
+    s21_list1.splice(s21_list1.end(), s21_list1, first, last);
+    std_list1.splice(std_list1.end(), std_list1, std_list1.begin(), std::next(std_list1.begin(), 2));
+    compare_lists(s21_list1, std_list1);
+    ASSERT_EQ(s21_list1.size(), 6);
+    ASSERT_EQ(s21_list1.front(), 2);
+
+    // Весь список в начало
+    s21_list1.splice(s21_list1.begin(), s21_list2);
+    std_list1.splice(std_list1.begin(), std_list2);
+    compare_lists(s21_list1, std_list1);
+    ASSERT_TRUE(s21_list2.empty());
+    ASSERT_EQ(s21_list1.size(), 8);
+    ASSERT_EQ(s21_list1.front(), 4);
+    check_nodes(s21_list1);
+    s21_list2.push_back(9);
+    ASSERT_EQ(s21_list2.front(), 9);
+    ASSERT_EQ(s21_list2.back(), 9);
+
+    // Из другого пула значения копируются
+    s21::list_node_pool <float> pool;
+    s21::list <float> pooled(pool);
+    pooled.push_back(10);
+    pooled.push_back(11);
+    s21_list1.splice(s21_list1.end(), pooled, pooled.begin());
+    s21_list1.splice(s21_list1.end(), pooled);
+    ASSERT_EQ(pool.size(), 0);
+    ASSERT_EQ(s21_list1.size(), 10);
+    ASSERT_EQ(s21_list1.back(), 11);
+}
+
+TEST(s21_list_case, reverse_relinks_nodes) {
+    s21::list <float> s21_list{ 1, 2, 3, 4 };
+    s21::list_item <float> *head = s21_list.begin().ptr_;
+    s21_list.reverse();
+    std::list <float> std_list{ 4, 3, 2, 1 };
+    compare_lists(s21_list, std_list);
+    ASSERT_EQ(s21_list.back(), 1);
+    ASSERT_EQ(s21_list.front(), 4);
+    ASSERT_EQ(head->next_, nullptr);
+    ASSERT_EQ(head->previous_->data_, 2);
+    s21_list.push_back(0);
+    ASSERT_EQ(head->next_->data_, 0);
+}
+
 TEST(s21_list_case, reverse) {
     std::initializer_list <float> data1{ 1, 2, 3, 4, 5 };
     s21::list <float> s21_list(data1);
@@ -206,10 +315,54 @@ TEST(s21_list_case, reverse) {
 
 
 TEST(s21_list_case, unique) {
+    // Удаляются только соседние повторы
     s21::list <float> s21_list{ 1, 2, 2, 3, 4, 5, 3 };
-    std::list <float> std_list{ 1, 2, 3, 4, 5 };
-    s21_list.unique();
+    std::list <float> std_list{ 1, 2, 2, 3, 4, 5, 3 };
+    ASSERT_EQ(s21_list.unique(), 1);
+    std_list.unique();
     compare_lists(s21_list, std_list);
+    ASSERT_EQ(s21_list.size(), 6);
+
+    s21::list <float> s21_list2{ 1, 1, 1, 2, 3, 3, 4, 4, 4, 4 };
+    std::list <float> std_list2{ 1, 2, 3, 4 };
+    ASSERT_EQ(s21_list2.unique(), 6);
+    compare_lists(s21_list2, std_list2);
+    ASSERT_EQ(s21_list2.back(), 4);
+    s21_list2.push_back(5);
+    s21_list2.pop_front();
+    compare_lists(s21_list2, std::list <float>{ 2, 3, 4, 5 });
+
+    s21::list <float> empty;
+    ASSERT_EQ(empty.unique(), 0);
+}
+
+TEST(s21_list_case, unique_predicate) {
+    // Предикат сравнивает с первым элементом группы: 1.0, 1.5, 1.9 - одна группа
+    s21::list_node_pool <float> pool;
+    s21::list <float> s21_list(pool);
+    std::list <float> std_list{ 1.0, 1.5, 1.9, 2.2, 2.1, 3.5 };
+    for (float value : std_list) s21_list.push_back(value);
+    std::vector <s21::list_item <float> *> removed;
+    for (auto it = s21_list.begin(); it != s21_list.end(); ++it) {
+        if (*it == 1.5f || *it == 1.9f || *it == 2.1f) removed.push_back(it.ptr_);
+    }
+    auto same_int = [](float a, float b) { return static_cast<int>(a) == static_cast<int>(b); };
+    ASSERT_EQ(s21_list.unique(same_int), 3);
+    std_list.unique(same_int);
+    compare_lists(s21_list, std_list);
+    ASSERT_EQ(pool.size(), 3);
+    ASSERT_EQ(s21_list.back(), 3.5);
+
+    // Удаленные узлы вернулись в пул одной цепочкой и выдаются в ее порядке
+    for (auto *node : removed) {
+        s21_list.push_back(0);
+        ASSERT_EQ((--s21_list.end()).ptr_, node);
+    }
+    s21::list_item <float> *head = s21_list.begin().ptr_;
+    s21_list.clear();
+    ASSERT_EQ(pool.size(), 0);
+    s21_list.push_back(7);
+    ASSERT_EQ(s21_list.begin().ptr_, head);
 }
 
 TEST(s21_list_case, sort) {
@@ -219,6 +372,79 @@ TEST(s21_list_case, sort) {
     compare_lists(s21_list, std_list);
 }
 
+TEST(s21_list_case, sort_relinks_nodes) {
+    std::vector <float> values;
+    for (int i = 0; i < 100000; ++i) values.push_back(static_cast<float>((i * 7919) % 1000));
+    s21::list <float> s21_list;
+    std::list <float> std_list;
+    for (float value : values) {
+        s21_list.push_back(value);
+        std_list.push_back(value);
+    }
+    std::map <s21::list_item <float> *, float> nodes;
+    for (auto it = s21_list.begin(); it != s21_list.end(); ++it) nodes[it.ptr_] = *it;
+    s21_list.sort();
+    std_list.sort();
+    compare_lists(s21_list, std_list);
+    // Значения остаются в своих узлах, меняются только связи
+    for (auto it = s21_list.begin(); it != s21_list.end(); ++it) ASSERT_EQ(nodes[it.ptr_], *it);
+    s21::list_item <float> *previous = nullptr;
+    for (s21::list_item <float> *item = s21_list.begin().ptr_; item; item = item->next_) {
+        ASSERT_EQ(item->previous_, previous);
+        previous = item;
+    }
+    ASSERT_EQ(previous->data_, 999);
+    ASSERT_EQ(s21_list.back(), 999);
+}
+
+TEST(s21_list_case, sort_stable) {
+    // Сравнение по целой части: равные элементы сохраняют исходный порядок
+    s21::list <float> s21_list{ 2.5, 1.5, 2.25, 0.5, 1.25, 2.75, 1.75 };
+    std::list <float> std_list{ 0.5, 1.5, 1.25, 1.75, 2.5, 2.25, 2.75 };
+    s21_list.sort([](float a, float b) { return static_cast<int>(a) < static_cast<int>(b); });
+    compare_lists(s21_list, std_list);
+    ASSERT_EQ(s21_list.front(), 0.5);
+    ASSERT_EQ(s21_list.back(), 2.75);
+
+    s21::list <float> empty;
+    empty.sort();
+    ASSERT_TRUE(empty.empty());
+    s21::list <float> single{ 1 };
+    single.sort();
+    ASSERT_EQ(single.front(), 1);
+    ASSERT_EQ(single.back(), 1);
+}
+
+TEST(s21_list_case, merge_sorted) {
+    s21::list <float> s21_list1{ 1, 3, 5, 7 };
+    s21::list <float> s21_list2{ 2, 3, 4, 8, 9 };
+    std::list <float> std_list1{ 1, 3, 5, 7 };
+    std::list <float> std_list2{ 2, 3, 4, 8, 9 };
+    s21::list_item <float> *node = s21_list2.begin().ptr_;
+    s21_list1.merge(s21_list2);
+    std_list1.merge(std_list2);
+    ASSERT_EQ(s21_list1.size(), 9);
+    ASSERT_TRUE(s21_list2.empty());
+    compare_lists(s21_list1, std_list1);
+    compare_lists(s21_list2, std_list2);
+    ASSERT_EQ(s21_list1.begin().ptr_->next_, node);
+    ASSERT_EQ(s21_list1.back(), 9);
+    s21_list1.pop_back();
+    ASSERT_EQ(s21_list1.back(), 8);
+
+    // Список из другого пула сливается копированием значений
+    s21::list_node_pool <float> pool;
+    s21::list <float> pooled(pool);
+    pooled.push_back(0);
+    pooled.push_back(10);
+    s21_list1.merge(pooled);
+    ASSERT_TRUE(pooled.empty());
+    ASSERT_EQ(pool.size(), 0);
+    ASSERT_EQ(s21_list1.front(), 0);
+    ASSERT_EQ(s21_list1.back(), 10);
+    ASSERT_EQ(s21_list1.size(), 10);
+}
+
 TEST(s21_list_case, emplace) {
     s21::list <float> s21_list{ 5, 4, 3, 2, 1 };
     std::list <float> std_list{ 5, 6, 7, 8, 4, 3, 2, 1 };
@@ -238,3 +464,88 @@ TEST(s21_list_case, emplace) {
     std::list <float> std_list2{ 111, 222, 333, 5, 0, 6, 7, 8, 4, 3, 2, 1, 444, 555, 666 };
     compare_lists(s21_list, std_list2);
 }
+
+TEST(s21_list_case, node_pool) {
+    s21::list_node_pool <float> pool(4);
+    s21::list <float> s21_list(pool);
+    std::list <float> std_list;
+    for (int i = 0; i < 10; ++i) {
+        s21_list.push_back(i);
+        std_list.push_back(i);
+    }
+    ASSERT_EQ(s21_list.pool(), &pool);
+    ASSERT_EQ(pool.size(), 10);
+    ASSERT_EQ(pool.capacity(), 12);
+    compare_lists(s21_list, std_list);
+
+    // Узлы одного блока лежат подряд
+    auto first = s21_list.begin();
+    auto second = first;
+    ++second;
+    ASSERT_EQ(first.ptr_ + 1, second.ptr_);
+
+    // Освобожденный узел выдается следующим
+    s21::list_item <float> *freed = s21_list.begin().ptr_;
+    s21_list.pop_front();
+    std_list.pop_front();
+    s21_list.push_front(42);
+    std_list.push_front(42);
+    ASSERT_EQ(s21_list.begin().ptr_, freed);
+    ASSERT_EQ(pool.size(), 10);
+    compare_lists(s21_list, std_list);
+
+    // Копия и второй список делят пул
+    s21::list <float> copy(s21_list);
+    ASSERT_EQ(copy.pool(), &pool);
+    ASSERT_EQ(pool.size(), 20);
+    s21::list <float> other(pool);
+    other.push_back(1);
+    other.insert(other.begin(), 2);
+    ASSERT_EQ(pool.size(), 22);
+    s21_list = std::move(other);
+    ASSERT_EQ(pool.size(), 12);
+    ASSERT_EQ(s21_list.front(), 2);
+    copy.clear();
+    s21_list.clear();
+    ASSERT_EQ(pool.size(), 0);
+    ASSERT_EQ(pool.capacity(), 24);
+
+    s21::list <float> heap;
+    ASSERT_EQ(heap.pool(), nullptr);
+    ASSERT_THROW(s21::list_node_pool <float>(0), std::invalid_argument);
+}
+
+TEST(s21_list_case, iterators) {
+    using list_type = s21::list <std::string>;
+    static_assert(std::is_same<std::iterator_traits<list_type::iterator>::iterator_category,
+                               std::bidirectional_iterator_tag>::value, "");
+    static_assert(std::is_same<std::iterator_traits<list_type::iterator>::reference,
+                               std::string &>::value, "");
+    static_assert(std::is_same<list_type::const_iterator::reference, const std::string &>::value, "");
+    static_assert(!std::is_convertible<list_type::const_iterator, list_type::iterator>::value, "");
+
+    list_type s21_list{ "one", "two", "three" };
+    // Разыменование дает ссылку на элемент узла, а не копию
+    ASSERT_EQ(&*s21_list.begin(), &s21_list.front());
+    *s21_list.begin() = "first";
+    s21_list.begin()->append("!");
+    ASSERT_EQ(s21_list.front(), "first!");
+    ASSERT_EQ(std::prev(s21_list.end())->size(), 5);
+
+    auto it = s21_list.begin();
+    ASSERT_EQ(*it++, "first!");
+    ASSERT_EQ(*it, "two");
+    ASSERT_EQ(*it--, "two");
+    ASSERT_TRUE(it == s21_list.begin());
+
+    const list_type &view = s21_list;
+    list_type::const_iterator cit = s21_list.begin();
+    ASSERT_TRUE(cit == view.begin());
+    ASSERT_TRUE(s21_list.begin() == view.cbegin());
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+
+    std::vector <std::string> reversed(s21_list.rbegin(), s21_list.rend());
+    ASSERT_EQ(reversed, (std::vector <std::string>{ "three", "two", "first!" }));
+    ASSERT_EQ(*view.rbegin(), "three");
+    ASSERT_EQ(std::find(view.begin(), view.end(), "two"), std::next(view.begin()));
+}
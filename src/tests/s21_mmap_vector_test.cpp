@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../classes/s21_mmap_vector.hpp"
+
+std::string mmap_vector_test_path(const std::string &name) {
+    return "/tmp/s21_mmap_vector_" + name + "_" + std::to_string(::getpid());
+}
+
+struct mmap_vector_record {
+    int32_t id_;
+    double value_;
+};
+
+TEST(s21_mmap_vector_case, create_and_reopen) {
+    std::string path = mmap_vector_test_path("reopen");
+    std::remove(path.c_str());
+    {
+        s21::mmap_vector<int> vector(path);
+        ASSERT_TRUE(vector.empty());
+        ASSERT_FALSE(vector.is_read_only());
+        ASSERT_EQ(vector.data(), nullptr);
+        for (int i = 0; i < 100000; ++i) vector.push_back(i);
+        ASSERT_EQ(vector.size(), 100000u);
+        ASSERT_GE(vector.capacity(), vector.size());
+        vector.flush();
+    }
+    {
+        s21::mmap_vector<int> vector(path, s21::mmap_vector<int>::mode::read_only);
+        const s21::mmap_vector<int> &view = vector;
+        ASSERT_TRUE(view.is_read_only());
+        ASSERT_EQ(view.size(), 100000u);
+        ASSERT_EQ(view.capacity(), 100000u);
+        for (int i = 0; i < 100000; ++i) ASSERT_EQ(view[i], i);
+        ASSERT_EQ(view.front(), 0);
+        ASSERT_EQ(view.back(), 99999);
+        ASSERT_EQ(view.end() - view.begin(), 100000);
+        ASSERT_EQ(view.data()[5], 5);
+        ASSERT_THROW(view.at(100000), std::out_of_range);
+        ASSERT_EQ(vector[7], 7);
+        ASSERT_EQ(vector.at(8), 8);
+        ASSERT_EQ(vector.end() - vector.begin(), 100000);
+        // Запись в закрытое отображение видна только этому объекту
+        vector[0] = -1;
+        ASSERT_EQ(view[0], -1);
+        ASSERT_THROW(vector.push_back(1), std::logic_error);
+        ASSERT_THROW(vector.reserve(200000), std::logic_error);
+        ASSERT_THROW(vector.clear(), std::logic_error);
+    }
+    {
+        const s21::mmap_vector<int> vector(path, s21::mmap_vector<int>::mode::read_only);
+        ASSERT_EQ(vector.size(), 100000u);
+        ASSERT_EQ(vector[0], 0);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(s21_mmap_vector_case, modify_in_place) {
+    std::string path = mmap_vector_test_path("modify");
+    std::remove(path.c_str());
+    {
+        s21::mmap_vector<mmap_vector_record> vector(path);
+        vector.resize(1000);
+        for (size_t i = 0; i < vector.size(); ++i) {
+            ASSERT_EQ(vector[i].id_, 0);
+            vector[i] = {static_cast<int32_t>(i), i * 0.5};
+        }
+        vector.pop_back();
+    }
+    {
+        s21::mmap_vector<mmap_vector_record> vector(path);
+        ASSERT_EQ(vector.size(), 999u);
+        ASSERT_EQ(vector.at(998).id_, 998);
+        ASSERT_EQ(vector.at(10).value_, 5.0);
+        vector.at(10).value_ = -1.0;
+        vector.resize(10);
+        vector.shrink_to_fit();
+        ASSERT_EQ(vector.capacity(), 10u);
+        vector.push_back(vector[0]);
+        ASSERT_EQ(vector.back().id_, 0);
+    }
+    {
+        using record_vector = s21::mmap_vector<mmap_vector_record>;
+        record_vector vector(path, record_vector::mode::read_only);
+        ASSERT_EQ(vector.size(), 11u);
+        ASSERT_EQ(vector[9].id_, 9);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(s21_mmap_vector_case, clear_and_move) {
+    std::string path = mmap_vector_test_path("move");
+    std::remove(path.c_str());
+    {
+        s21::mmap_vector<double> vector(path);
+        vector.reserve(10);
+        ASSERT_GE(vector.capacity(), 10u);
+        vector.push_back(1.5);
+        vector.push_back(2.5);
+        s21::mmap_vector<double> moved(std::move(vector));
+        ASSERT_EQ(moved.size(), 2u);
+        ASSERT_EQ(vector.size(), 0u);
+        vector = std::move(moved);
+        ASSERT_EQ(vector.back(), 2.5);
+        size_t capacity = vector.capacity();
+        vector.clear();
+        ASSERT_TRUE(vector.empty());
+        ASSERT_EQ(vector.capacity(), capacity);
+        ASSERT_THROW(vector.pop_back(), std::out_of_range);
+        ASSERT_THROW(vector.front(), std::out_of_range);
+        vector.push_back(3.5);
+    }
+    {
+        s21::mmap_vector<double> vector(path);
+        ASSERT_EQ(vector.size(), 1u);
+        ASSERT_EQ(vector[0], 3.5);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(s21_mmap_vector_case, errors) {
+    ASSERT_THROW(s21::mmap_vector<int>("/nonexistent/dir/file", s21::mmap_vector<int>::mode::read_only),
+                 std::system_error);
+    std::string path = mmap_vector_test_path("odd");
+    std::remove(path.c_str());
+    {
+        s21::mmap_vector<char> vector(path);
+        for (char c : std::string("abcde")) vector.push_back(c);
+    }
+    ASSERT_THROW(s21::mmap_vector<int> vector(path), std::invalid_argument);
+    std::remove(path.c_str());
+}
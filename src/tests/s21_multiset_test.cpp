@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include <initializer_list>
 #include <fstream>
 
@@ -173,3 +178,52 @@ TEST(s21_multiset_case, out_test_for_coverage) {
     std::ofstream out("/dev/null");
     out << s21_ms << std::endl;
 }
+
+TEST(s21_multiset_case, iterators) {
+    using multiset_type = s21::multiset <std::string>;
+    static_assert(std::is_same<std::iterator_traits<multiset_type::iterator>::iterator_category,
+                               std::bidirectional_iterator_tag>::value, "");
+    static_assert(std::is_same<multiset_type::iterator::reference, const std::string &>::value, "");
+
+    multiset_type s21_ms{ "b", "a", "b", "c", "b" };
+    auto it = s21_ms.find("b");
+    ASSERT_EQ(&*it, &*s21_ms.find("b"));
+    ASSERT_EQ(it->size(), 1);
+    ASSERT_EQ(*it++, "b");
+    ASSERT_EQ(*it++, "b");
+    ASSERT_EQ(*it++, "b");
+    ASSERT_EQ(*it, "c");
+    ASSERT_EQ(*it--, "c");
+    ASSERT_EQ(*it, "b");
+
+    std::vector <std::string> reversed(s21_ms.rbegin(), s21_ms.rend());
+    ASSERT_EQ(reversed, (std::vector <std::string>{ "c", "b", "b", "b", "a" }));
+    ASSERT_EQ(std::distance(s21_ms.cbegin(), s21_ms.cend()), 5);
+    ASSERT_EQ(std::count(s21_ms.begin(), s21_ms.end(), "b"), 3);
+}
+
+TEST(s21_multiset_case, stable_references) {
+    // Ссылки на повторы ключа, как у std::multiset, переживают вставки и удаление других элементов
+    s21::multiset <std::string> s21_ms{ "b", "a" };
+    auto first = s21_ms.insert("b");
+    const std::string &duplicate = *first;
+    const std::string *address = &duplicate;
+    for (int i = 0; i < 100; ++i) s21_ms.insert("b");
+    ASSERT_EQ(&*first, address);
+    ASSERT_EQ(duplicate, "b");
+
+    s21_ms.erase(s21_ms.find("b"));
+    s21_ms.erase(std::next(first));
+    ASSERT_EQ(&*first, address);
+    ASSERT_EQ(s21_ms.count("b"), 100);
+    ASSERT_EQ(s21_ms.size(), 101);
+    ASSERT_EQ(*s21_ms.find("b"), "b");
+    ASSERT_EQ(std::distance(s21_ms.find("b"), s21_ms.upper_bound("b")), 100);
+
+    auto [lower, upper] = s21_ms.equal_range("b");
+    ASSERT_EQ(std::distance(lower, upper), 100);
+    ASSERT_TRUE(upper == s21_ms.end());
+    s21_ms.erase(s21_ms.find("a"));
+    ASSERT_EQ(*s21_ms.begin(), "b");
+    ASSERT_EQ(*std::prev(s21_ms.end()), "b");
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>  // NOLINT(build/c++11)
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../classes/s21_parallel.hpp"
+
+template <typename T>
+s21::vector<T> parallel_random_vector(size_t n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-1000000, 1000000);
+    s21::vector<T> vector;
+    vector.reserve(n);
+    for (size_t i = 0; i < n; ++i) vector.push_back(static_cast<T>(dist(gen)) / T(7));
+    return vector;
+}
+
+TEST(s21_thread_pool_case, submit) {
+    s21::thread_pool pool(3);
+    ASSERT_EQ(pool.size(), 3u);
+    auto answer = pool.submit([] { return 42; });
+    auto text = pool.submit([] { return std::string("pool"); });
+    ASSERT_EQ(answer.get(), 42);
+    ASSERT_EQ(text.get(), "pool");
+    auto failed = pool.submit([]() -> int { throw std::runtime_error("task"); });
+    ASSERT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(s21_thread_pool_case, zero_threads) {
+    s21::thread_pool pool(0);
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.submit([] { return 1; }).get(), 1);
+}
+
+TEST(s21_thread_pool_case, parallel_for) {
+    s21::thread_pool pool(4);
+    std::atomic<size_t> sum{0};
+    s21::vector<int> visited(1000);
+    pool.parallel_for(1000, [&](size_t i) {
+        sum += i;
+        ++visited[i];
+    });
+    ASSERT_EQ(sum.load(), 999u * 1000u / 2);
+    ASSERT_EQ(std::count(visited.begin(), visited.end(), 1), 1000);
+    pool.parallel_for(0, [](size_t) { FAIL(); });
+}
+
+TEST(s21_thread_pool_case, parallel_for_exception) {
+    s21::thread_pool pool(4);
+    ASSERT_THROW(pool.parallel_for(100,
+                                   [](size_t i) {
+                                       if (i == 57) throw std::logic_error("chunk");
+                                   }),
+                 std::logic_error);
+    ASSERT_EQ(pool.submit([] { return 7; }).get(), 7);
+}
+
+TEST(s21_thread_pool_case, nested_parallel_for) {
+    // Внешние задачи занимают все потоки, внутренние вызовы выполняются вызывающими потоками
+    s21::thread_pool pool(2);
+    std::atomic<size_t> calls{0};
+    pool.parallel_for(8, [&](size_t) { pool.parallel_for(16, [&](size_t) { ++calls; }); });
+    ASSERT_EQ(calls.load(), 8u * 16u);
+}
+
+TEST(s21_parallel_case, sort) {
+    for (size_t threads : {1, 3, 8}) {
+        s21::thread_pool pool(threads);
+        for (size_t n : {0ul, 1ul, 1000ul, s21::parallel_grain + 1, 5 * s21::parallel_grain + 17}) {
+            s21::vector<int> vector = parallel_random_vector<int>(n, static_cast<unsigned>(n));
+            s21::vector<int> expected(vector);
+            std::sort(expected.begin(), expected.end());
+            s21::parallel_sort(pool, vector);
+            ASSERT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin()));
+            s21::parallel_sort(pool, vector, std::greater<int>());
+            ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end(), std::greater<int>()));
+        }
+    }
+}
+
+TEST(s21_parallel_case, sort_strings) {
+    s21::thread_pool pool(4);
+    s21::vector<std::string> vector;
+    const size_t n = 3 * s21::parallel_grain;
+    for (size_t i = 0; i < n; ++i) vector.push_back(std::to_string((i * 7919) % n));
+    s21::parallel_sort(pool, vector);
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end()));
+    ASSERT_EQ(vector.size(), n);
+}
+
+TEST(s21_parallel_case, for_each_and_transform) {
+    s21::thread_pool pool(4);
+    const size_t n = 10 * s21::parallel_grain + 3;
+    s21::vector<int> vector(n);
+    s21::parallel_for_each(pool, vector, [](int &value) { value += 2; });
+    ASSERT_EQ(std::count(vector.begin(), vector.end(), 2), static_cast<long>(n));
+    s21::vector<double> out(n);
+    s21::parallel_transform(pool, vector, out, [](int value) { return value * 1.5; });
+    ASSERT_EQ(std::count(out.begin(), out.end(), 3.0), static_cast<long>(n));
+    s21::vector<double> small(n - 1);
+    ASSERT_THROW(s21::parallel_transform(pool, vector, small, [](int value) { return value * 1.0; }),
+                 std::out_of_range);
+    s21::parallel_for_each(vector, [](int &value) { value = 1; });
+    s21::parallel_transform(vector, out, [](int value) { return value * 0.5; });
+    ASSERT_EQ(std::count(out.begin(), out.end(), 0.5), static_cast<long>(n));
+}
+
+TEST(s21_parallel_case, reduce) {
+    s21::thread_pool pool(4);
+    for (size_t n : {0ul, 5ul, s21::parallel_grain, 7 * s21::parallel_grain + 5}) {
+        s21::vector<long> vector = parallel_random_vector<long>(n, 3);
+        long expected = std::accumulate(vector.begin(), vector.end(), 10l);
+        ASSERT_EQ(s21::parallel_reduce(pool, vector, 10l), expected);
+    }
+    s21::vector<int> vector(3 * s21::parallel_grain);
+    std::iota(vector.begin(), vector.end(), 0);
+    ASSERT_EQ(s21::parallel_reduce(vector, 0, [](int a, int b) { return std::max(a, b); }),
+              static_cast<int>(3 * s21::parallel_grain - 1));
+}
+
+TEST(s21_parallel_case, reduce_deterministic) {
+    s21::vector<double> vector = parallel_random_vector<double>(13 * s21::parallel_grain + 11, 5);
+    s21::thread_pool single(1);
+    double expected = s21::parallel_reduce(single, vector, 0.0);
+    for (size_t threads : {2, 3, 7, 16}) {
+        s21::thread_pool pool(threads);
+        ASSERT_EQ(s21::parallel_reduce(pool, vector, 0.0), expected);
+    }
+}
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include <initializer_list>
 
 #include "../classes/s21_set.hpp"
@@ -124,3 +129,27 @@ TEST(s21_set_case, emplace) {
     ASSERT_EQ(emp_res, true);
     compare_lists(s21_set, std_set);
 }
+
+TEST(s21_set_case, iterators) {
+    using set_type = s21::set <std::string>;
+    static_assert(std::is_same<std::iterator_traits<set_type::iterator>::iterator_category,
+                               std::bidirectional_iterator_tag>::value, "");
+    static_assert(std::is_same<std::iterator_traits<set_type::iterator>::reference,
+                               const std::string &>::value, "");
+
+    set_type s21_set{ "b", "d", "a", "c" };
+    auto found = s21_set.find("c");
+    ASSERT_EQ(&*found, &*std::next(s21_set.begin(), 2));
+    ASSERT_EQ(found->size(), 1);
+    ASSERT_EQ(*found++, "c");
+    ASSERT_EQ(*found, "d");
+    ASSERT_TRUE(++found == s21_set.end());
+    ASSERT_EQ(*--found, "d");
+    ASSERT_EQ(*found--, "d");
+    ASSERT_EQ(*found, "c");
+
+    std::vector <std::string> reversed(s21_set.rbegin(), s21_set.rend());
+    ASSERT_EQ(reversed, (std::vector <std::string>{ "d", "c", "b", "a" }));
+    ASSERT_EQ(std::distance(s21_set.cbegin(), s21_set.cend()), 4);
+    ASSERT_EQ(*std::find(s21_set.begin(), s21_set.end(), "b"), "b");
+}
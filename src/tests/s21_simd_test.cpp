@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+#include "../classes/s21_simd.hpp"
+
+template <typename T>
+s21::vector<T> simd_random_vector(size_t n, int range, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-range, range);
+    s21::vector<T> vector;
+    for (size_t i = 0; i < n; ++i) vector.push_back(static_cast<T>(dist(gen)));
+    return vector;
+}
+
+template <typename T>
+void simd_check_kernels() {
+    for (auto isa : {s21::simd::isa::scalar, s21::simd::isa::sse2, s21::simd::isa::avx2}) {
+        s21::simd::force_isa(isa);
+        for (size_t n : {0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1027}) {
+            s21::vector<T> vector = simd_random_vector<T>(n, 50, static_cast<unsigned>(n));
+            T *first = vector.begin();
+            T *last = vector.end();
+            for (T needle : {T(-50), T(0), T(7), T(1000)}) {
+                ASSERT_EQ(s21::simd::find(vector, needle), std::find(first, last, needle));
+                size_t expected = std::count(first, last, needle);
+                ASSERT_EQ(s21::simd::count(vector, needle), expected);
+            }
+            ASSERT_EQ(s21::simd::sum(vector), std::accumulate(first, last, s21::simd::sum_type<T>(0)));
+            if (n > 0) {
+                ASSERT_EQ(s21::simd::min(vector), *std::min_element(first, last));
+                ASSERT_EQ(s21::simd::max(vector), *std::max_element(first, last));
+            }
+            s21::vector<T> copy(vector);
+            ASSERT_TRUE(s21::simd::equal(vector, copy));
+            if (n > 0) {
+                copy[n - 1] = T(5000);
+                ASSERT_FALSE(s21::simd::equal(vector, copy));
+                copy[n - 1] = vector[n - 1];
+                copy[n / 2] = T(-5000);
+                ASSERT_FALSE(s21::simd::equal(vector, copy));
+            }
+        }
+    }
+    s21::simd::force_isa(s21::simd::supported_isa());
+}
+
+TEST(s21_simd_case, int32_kernels) { simd_check_kernels<int32_t>(); }
+
+TEST(s21_simd_case, float_kernels) { simd_check_kernels<float>(); }
+
+TEST(s21_simd_case, double_kernels) { simd_check_kernels<double>(); }
+
+TEST(s21_simd_case, scalar_fallback_types) { simd_check_kernels<int16_t>(); }
+
+TEST(s21_simd_case, int32_sum_no_overflow) {
+    s21::vector<int32_t> vector(1000);
+    for (auto &value : vector) value = INT32_MAX;
+    ASSERT_EQ(s21::simd::sum(vector), static_cast<int64_t>(INT32_MAX) * 1000);
+}
+
+TEST(s21_simd_case, aligned_vector) {
+    s21::vector<float, s21::aligned_vector_storage<64>> vector;
+    for (int i = 0; i < 100; ++i) vector.push_back(static_cast<float>(i % 17));
+    ASSERT_EQ(s21::simd::count(vector, 3.0f), 6u);
+    ASSERT_EQ(s21::simd::max(vector), 16.0f);
+    ASSERT_EQ(s21::simd::find(vector, 16.0f), vector.begin() + 16);
+}
+
+TEST(s21_simd_case, empty_min_max) {
+    s21::vector<double> vector;
+    ASSERT_THROW(s21::simd::min(vector), std::out_of_range);
+    ASSERT_THROW(s21::simd::max(vector), std::out_of_range);
+}
+
+TEST(s21_simd_case, force_isa) {
+    s21::simd::force_isa(s21::simd::isa::scalar);
+    ASSERT_EQ(s21::simd::active_isa(), s21::simd::isa::scalar);
+    s21::simd::force_isa(s21::simd::isa::avx2);
+    ASSERT_EQ(s21::simd::active_isa(), s21::simd::supported_isa());
+}
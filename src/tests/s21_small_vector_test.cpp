@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../classes/s21_small_vector.hpp"
+
+TEST(s21_small_vector_case, create) {
+    s21::small_vector<int, 4> vector;
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), 4);
+    ASSERT_TRUE(vector.is_inline());
+
+    s21::small_vector<int, 4> vector2(3);
+    ASSERT_EQ(vector2.size(), 3);
+    ASSERT_TRUE(vector2.is_inline());
+    for (long unsigned i = 0; i < vector2.size(); i++) ASSERT_EQ(vector2[i], 0);
+
+    s21::small_vector<int, 4> vector3{1, 2, 3, 4, 5, 6};
+    ASSERT_EQ(vector3.size(), 6);
+    ASSERT_FALSE(vector3.is_inline());
+    for (long unsigned i = 0; i < vector3.size(); i++) ASSERT_EQ(vector3[i], i + 1);
+}
+
+TEST(s21_small_vector_case, spill_to_heap) {
+    s21::small_vector<std::string, 8> vector;
+    std::vector<std::string> vector2;
+    for (int i = 0; i < 8; ++i) {
+        vector.push_back(std::to_string(i));
+        vector2.push_back(std::to_string(i));
+    }
+    ASSERT_TRUE(vector.is_inline());
+    vector.push_back(vector[0]);
+    vector2.push_back(vector2[0]);
+    ASSERT_FALSE(vector.is_inline());
+    ASSERT_EQ(vector.capacity(), 16);
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+
+    vector.erase(vector.begin(), vector.begin() + 5);
+    vector.shrink_to_fit();
+    ASSERT_TRUE(vector.is_inline());
+    ASSERT_EQ(vector.capacity(), 8);
+    ASSERT_EQ(vector.front(), "5");
+    ASSERT_EQ(vector.back(), "0");
+}
+
+TEST(s21_small_vector_case, copy_move) {
+    s21::small_vector<std::string, 2> small{"a", "b"};
+    s21::small_vector<std::string, 2> big{"a", "b", "c", "d"};
+
+    s21::small_vector<std::string, 2> small_copy(small);
+    s21::small_vector<std::string, 2> big_copy(big);
+    ASSERT_EQ(small_copy.size(), 2);
+    ASSERT_EQ(big_copy[3], "d");
+
+    std::string *big_data = big.data();
+    s21::small_vector<std::string, 2> big_moved(std::move(big));
+    ASSERT_EQ(big_moved.data(), big_data);
+    ASSERT_TRUE(big.empty());
+    ASSERT_TRUE(big.is_inline());
+
+    s21::small_vector<std::string, 2> small_moved;
+    small_moved = std::move(small);
+    ASSERT_TRUE(small_moved.is_inline());
+    ASSERT_EQ(small_moved[1], "b");
+    ASSERT_TRUE(small.empty());
+}
+
+TEST(s21_small_vector_case, swap) {
+    s21::small_vector<int, 4> vector{1, 2};
+    s21::small_vector<int, 4> vector2{3, 4, 5, 6, 7};
+    vector.swap(vector2);
+    ASSERT_EQ(vector.size(), 5);
+    ASSERT_EQ(vector[4], 7);
+    ASSERT_EQ(vector2.size(), 2);
+    ASSERT_TRUE(vector2.is_inline());
+    ASSERT_EQ(vector2[1], 2);
+}
+
+TEST(s21_small_vector_case, modifiers) {
+    s21::small_vector<int, 4> vector{1, 5};
+    std::vector<int> vector2{1, 5};
+    std::vector<int> batch{2, 3, 4};
+    vector.insert(vector.begin() + 1, batch.begin(), batch.end());
+    vector2.insert(vector2.begin() + 1, batch.begin(), batch.end());
+    vector.insert(vector.end(), 2, 9);
+    vector2.insert(vector2.end(), 2, 9);
+    vector.emplace(vector.begin(), 0);
+    vector2.emplace(vector2.begin(), 0);
+    vector.erase(vector.begin() + 2);
+    vector2.erase(vector2.begin() + 2);
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+
+    ASSERT_EQ(vector.erase_if([](int value) { return value == 9; }), 2);
+    vector.pop_back();
+    ASSERT_EQ(vector.back(), 4);
+    ASSERT_EQ(vector.at(0), 0);
+    ASSERT_THROW(vector.at(10), std::out_of_range);
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_THROW(vector.pop_back(), std::out_of_range);
+}
+
+// vector_throwing_item определен в s21_vector_test.cpp
+TEST(s21_small_vector_case, exception_safety) {
+    {
+        s21::small_vector<vector_throwing_item, 4> vector{1, 2, 3, 4};
+        ASSERT_TRUE(vector.is_inline());
+        // Переход в кучу: бросает новый элемент, затем копия при переносе
+        vector_throwing_item::throw_after = 0;
+        ASSERT_THROW(vector.emplace_back(5), std::runtime_error);
+        vector_throwing_item::throw_after = 2;
+        ASSERT_THROW(vector.emplace(vector.begin() + 1, 5), std::runtime_error);
+        vector_throwing_item::throw_after = 1;
+        ASSERT_THROW(vector.reserve(10), std::runtime_error);
+        vector_throwing_item::throw_after = -1;
+        ASSERT_TRUE(vector.is_inline());
+        ASSERT_EQ(vector.size(), 4);
+        // Копия при заполнении освобожденных слотов в куче
+        vector.reserve(10);
+        vector_throwing_item value(42);
+        vector_throwing_item::throw_after = 1 + 3 + 1;
+        ASSERT_THROW(vector.insert(vector.begin() + 1, 3, value), std::runtime_error);
+        vector_throwing_item::throw_after = -1;
+        ASSERT_EQ(vector.size(), 4);
+        for (int i = 0; i < 4; ++i) ASSERT_EQ(vector[i].value_, i + 1);
+        ASSERT_EQ(vector_throwing_item::live, 5);
+    }
+    ASSERT_EQ(vector_throwing_item::live, 0);
+}
+
+TEST(s21_small_vector_case, over_aligned) {
+    struct alignas(64) wide {
+        int value;
+    };
+    s21::small_vector<wide, 2> vector;
+    for (int i = 0; i < 10; ++i) {
+        vector.push_back(wide{i});
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(vector.data()) % 64, 0u);
+    }
+    ASSERT_FALSE(vector.is_inline());
+    for (int i = 0; i < 10; ++i) ASSERT_EQ(vector[i].value, i);
+}
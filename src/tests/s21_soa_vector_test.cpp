@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "../classes/s21_soa_vector.hpp"
+
+TEST(s21_soa_vector_case, create) {
+    s21::soa_vector<int, double> vector;
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.size(), 0u);
+
+    s21::soa_vector<int, std::string> vector2(5);
+    ASSERT_EQ(vector2.size(), 5u);
+    ASSERT_EQ(vector2[4].get<0>(), 0);
+    ASSERT_EQ(vector2[4].get<1>(), "");
+    ASSERT_EQ(vector2.end<1>() - vector2.begin<1>(), 5);
+}
+
+TEST(s21_soa_vector_case, push_back_and_columns) {
+    s21::soa_vector<int64_t, double, char> vector;
+    for (int i = 0; i < 1000; ++i) vector.push_back(i, i * 0.5, static_cast<char>('a' + i % 26));
+    ASSERT_EQ(vector.size(), 1000u);
+    ASSERT_GE(vector.capacity(), 1000u);
+    int64_t *ids = vector.data<0>();
+    double *values = vector.data<1>();
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(ids[i], i);
+        ASSERT_EQ(values[i], i * 0.5);
+    }
+    ASSERT_EQ(std::accumulate(vector.begin<0>(), vector.end<0>(), int64_t(0)), 999 * 1000 / 2);
+    ASSERT_EQ(vector.back().get<2>(), 'a' + 999 % 26);
+    vector.push_back(std::make_tuple(int64_t(-1), -1.0, 'z'));
+    ASSERT_EQ(vector.back().get<0>(), -1);
+    vector.pop_back();
+    ASSERT_EQ(vector.size(), 1000u);
+}
+
+TEST(s21_soa_vector_case, row_proxy) {
+    s21::soa_vector<int, std::string> vector;
+    vector.emplace_back(1, "one");
+    vector.emplace_back(2, "two");
+    auto row = vector[1];
+    row.get<1>() += "!";
+    ASSERT_EQ(vector.at(1).get<1>(), "two!");
+    std::tuple<int, std::string> copy = vector[0];
+    ASSERT_EQ(std::get<1>(copy), "one");
+    vector[0] = std::make_tuple(10, std::string("ten"));
+    ASSERT_EQ(vector.front().get<0>(), 10);
+    vector[1] = vector[0];
+    ASSERT_EQ(vector[1].get<1>(), "ten");
+    ASSERT_THROW(vector.at(2), std::out_of_range);
+}
+
+TEST(s21_soa_vector_case, self_reference_on_growth) {
+    s21::soa_vector<std::string, int> vector;
+    vector.push_back("seed", 1);
+    for (int i = 0; i < 100; ++i) vector.push_back(vector[0].get<0>(), vector[i].get<1>() + 1);
+    ASSERT_EQ(vector.size(), 101u);
+    ASSERT_EQ(vector[100].get<0>(), "seed");
+    ASSERT_EQ(vector[100].get<1>(), 101);
+}
+
+struct soa_vector_throwing_item {
+    static int countdown;
+    int value_;
+    soa_vector_throwing_item(int value = 0) : value_(value) {  // NOLINT(runtime/explicit)
+        if (countdown-- == 0) throw std::runtime_error("construct");
+    }
+    soa_vector_throwing_item(const soa_vector_throwing_item &other) : value_(other.value_) {
+        if (countdown-- == 0) throw std::runtime_error("copy");
+    }
+    soa_vector_throwing_item(soa_vector_throwing_item &&other) noexcept : value_(other.value_) {}
+    soa_vector_throwing_item &operator=(const soa_vector_throwing_item &) = default;
+};
+
+int soa_vector_throwing_item::countdown = -1;
+
+TEST(s21_soa_vector_case, exception_keeps_columns_aligned) {
+    s21::soa_vector<int, soa_vector_throwing_item> vector;
+    vector.reserve(4);
+    vector.emplace_back(1, 1);
+    soa_vector_throwing_item::countdown = 0;
+    ASSERT_THROW(vector.emplace_back(2, 2), std::runtime_error);
+    soa_vector_throwing_item::countdown = -1;
+    ASSERT_EQ(vector.size(), 1u);
+    vector.emplace_back(3, 3);
+    ASSERT_EQ(vector[1].get<0>(), 3);
+    ASSERT_EQ(vector[1].get<1>().value_, 3);
+}
+
+TEST(s21_soa_vector_case, copy_move_swap_clear) {
+    s21::soa_vector<int, double> vector;
+    for (int i = 0; i < 10; ++i) vector.push_back(i, i);
+    s21::soa_vector<int, double> copy(vector);
+    ASSERT_EQ(copy.size(), 10u);
+    ASSERT_EQ(copy[9].get<1>(), 9.0);
+    s21::soa_vector<int, double> moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 10u);
+    ASSERT_EQ(copy.size(), 0u);
+    s21::soa_vector<int, double> other;
+    other.push_back(-1, -1);
+    other.swap(moved);
+    ASSERT_EQ(other.size(), 10u);
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(moved[0].get<0>(), -1);
+    copy = other;
+    ASSERT_EQ(copy[3].get<0>(), 3);
+    size_t capacity = copy.capacity();
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(copy.capacity(), capacity);
+    copy.shrink_to_fit();
+    ASSERT_EQ(copy.capacity(), 0u);
+    ASSERT_THROW(copy.pop_back(), std::out_of_range);
+    ASSERT_THROW(copy.front(), std::out_of_range);
+}
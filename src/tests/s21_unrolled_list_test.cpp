@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <string>
+
+#include "../classes/s21_unrolled_list.hpp"
+
+// Блок на 4 элемента int, чтобы деление и слияние блоков проверялись на коротких списках
+using small_unrolled_list = s21::unrolled_list<int, 2 * sizeof(void *) + sizeof(size_t) + 4 * sizeof(int)>;
+
+template <class List>
+void compare_unrolled(List &unrolled, std::list<int> const &expected) {
+    ASSERT_EQ(unrolled.size(), expected.size());
+    auto it = unrolled.begin();
+    for (int value : expected) {
+        ASSERT_EQ(*it, value);
+        ++it;
+    }
+    ASSERT_TRUE(it == unrolled.end());
+    // Обратный проход
+    for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit) {
+        --it;
+        ASSERT_EQ(*it, *rit);
+    }
+}
+
+TEST(s21_unrolled_list_case, constructors) {
+    ASSERT_EQ(small_unrolled_list::block_capacity, 4);
+    ASSERT_GT((s21::unrolled_list<int>::block_capacity), 100);
+    small_unrolled_list empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_TRUE(empty.begin() == empty.end());
+    ASSERT_THROW(empty.front(), std::out_of_range);
+    ASSERT_THROW(empty.pop_back(), std::out_of_range);
+
+    small_unrolled_list sized(6);
+    compare_unrolled(sized, {0, 0, 0, 0, 0, 0});
+    small_unrolled_list items{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    compare_unrolled(items, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    small_unrolled_list copy(items);
+    compare_unrolled(copy, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    small_unrolled_list moved(std::move(copy));
+    ASSERT_TRUE(copy.empty());
+    compare_unrolled(moved, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    sized = moved;
+    compare_unrolled(sized, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    sized = std::move(moved);
+    compare_unrolled(sized, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    ASSERT_EQ(sized.front(), 1);
+    ASSERT_EQ(sized.back(), 9);
+}
+
+TEST(s21_unrolled_list_case, insert_erase) {
+    small_unrolled_list unrolled;
+    std::list<int> expected;
+    for (int i = 0; i < 40; ++i) {
+        // Вставка в середину делит полные блоки
+        auto pos = unrolled.begin();
+        auto std_pos = expected.begin();
+        for (int step = 0; step < i / 2; ++step, ++pos, ++std_pos) {
+        }
+        auto it = unrolled.insert(pos, i);
+        expected.insert(std_pos, i);
+        ASSERT_EQ(*it, i);
+    }
+    compare_unrolled(unrolled, expected);
+
+    // Удаление каждого второго сливает полупустые блоки
+    auto it = unrolled.begin();
+    auto std_it = expected.begin();
+    while (it != unrolled.end()) {
+        it = unrolled.erase(it);
+        std_it = expected.erase(std_it);
+        if (it != unrolled.end()) {
+            ASSERT_EQ(*it, *std_it);
+            ++it;
+            ++std_it;
+        }
+    }
+    compare_unrolled(unrolled, expected);
+    while (!unrolled.empty()) {
+        unrolled.erase(unrolled.begin());
+        expected.pop_front();
+        compare_unrolled(unrolled, expected);
+    }
+}
+
+TEST(s21_unrolled_list_case, iterator_stability) {
+    // Элементы других блоков не перемещаются при вставке и удалении
+    small_unrolled_list unrolled{0, 1, 2, 3, 4, 5, 6, 7};
+    auto it = unrolled.begin();
+    std::advance(it, 6);
+    int *address = &*it;
+    unrolled.insert(std::next(unrolled.begin()), 100);
+    unrolled.erase(unrolled.begin());
+    ASSERT_EQ(&*it, address);
+    ASSERT_EQ(*it, 6);
+    ASSERT_EQ(*std::next(it), 7);
+}
+
+TEST(s21_unrolled_list_case, push_pop) {
+    small_unrolled_list unrolled;
+    std::list<int> expected;
+    for (int i = 0; i < 10; ++i) {
+        unrolled.push_back(i);
+        unrolled.push_front(-i);
+        expected.push_back(i);
+        expected.push_front(-i);
+    }
+    compare_unrolled(unrolled, expected);
+    for (int i = 0; i < 7; ++i) {
+        unrolled.pop_back();
+        unrolled.pop_front();
+        expected.pop_back();
+        expected.pop_front();
+    }
+    compare_unrolled(unrolled, expected);
+    unrolled.emplace_back(50);
+    unrolled.emplace_front(-50);
+    expected.push_back(50);
+    expected.push_front(-50);
+    compare_unrolled(unrolled, expected);
+    ASSERT_EQ(unrolled.back(), 50);
+    ASSERT_EQ(unrolled.front(), -50);
+}
+
+TEST(s21_unrolled_list_case, operations) {
+    small_unrolled_list first{1, 3, 5, 7, 9, 11};
+    small_unrolled_list second{2, 3, 4, 10};
+    first.merge(second);
+    ASSERT_TRUE(second.empty());
+    compare_unrolled(first, {1, 2, 3, 3, 4, 5, 7, 9, 10, 11});
+
+    small_unrolled_list spliced{100, 101, 102, 103, 104};
+    auto pos = first.begin();
+    std::advance(pos, 2);
+    first.splice(pos, spliced);
+    ASSERT_TRUE(spliced.empty());
+    compare_unrolled(first, {1, 2, 100, 101, 102, 103, 104, 3, 3, 4, 5, 7, 9, 10, 11});
+    small_unrolled_list tail{-1};
+    first.splice(first.end(), tail);
+    ASSERT_EQ(first.back(), -1);
+
+    first.reverse();
+    compare_unrolled(first, {-1, 11, 10, 9, 7, 5, 4, 3, 3, 104, 103, 102, 101, 100, 2, 1});
+    first.sort();
+    compare_unrolled(first, {-1, 1, 2, 3, 3, 4, 5, 7, 9, 10, 11, 100, 101, 102, 103, 104});
+    ASSERT_EQ(first.unique(), 1);
+    compare_unrolled(first, {-1, 1, 2, 3, 4, 5, 7, 9, 10, 11, 100, 101, 102, 103, 104});
+    ASSERT_EQ(first.unique([](int a, int b) { return a / 100 == b / 100; }), 13);
+    compare_unrolled(first, {-1, 100});
+
+    small_unrolled_list other{5, 6};
+    first.swap(other);
+    compare_unrolled(first, {5, 6});
+    compare_unrolled(other, {-1, 100});
+}
+
+TEST(s21_unrolled_list_case, splice_ranges) {
+    small_unrolled_list first;
+    small_unrolled_list second;
+    std::list<int> std_first;
+    std::list<int> std_second;
+    for (int i = 0; i < 30; ++i) {
+        first.push_back(i);
+        std_first.push_back(i);
+        second.push_back(100 + i);
+        std_second.push_back(100 + i);
+    }
+    // Один элемент из середины блока другого списка в середину блока
+    first.splice(std::next(first.begin(), 5), second, std::next(second.begin(), 6));
+    std_first.splice(std::next(std_first.begin(), 5), std_second, std::next(std_second.begin(), 6));
+    compare_unrolled(first, std_first);
+    compare_unrolled(second, std_second);
+
+    // Диапазоны с неполными крайними блоками и из целых блоков, в начало, середину и конец
+    const int ranges[][3] = {{0, 1, 10}, {7, 3, 4}, {30, 0, 8}, {2, 3, 9}, {0, 0, 3}, {12, 1, 2}};
+    for (auto &range : ranges) {
+        first.splice(std::next(first.begin(), range[0]), second, std::next(second.begin(), range[1]),
+                     std::next(second.begin(), range[2]));
+        std_first.splice(std::next(std_first.begin(), range[0]), std_second,
+                         std::next(std_second.begin(), range[1]), std::next(std_second.begin(), range[2]));
+        compare_unrolled(first, std_first);
+        compare_unrolled(second, std_second);
+    }
+    first.splice(first.end(), second, second.begin(), second.end());
+    std_first.splice(std_first.end(), std_second, std_second.begin(), std_second.end());
+    compare_unrolled(first, std_first);
+    ASSERT_TRUE(second.empty());
+
+    // Внутри одного списка: вперед, назад, соседние позиции и один элемент
+    const int moves[][3] = {{0, 5, 9}, {40, 3, 17}, {9, 10, 20}, {3, 20, 37}, {1, 2, 3}, {60, 0, 1}};
+    for (auto &move : moves) {
+        first.splice(std::next(first.begin(), move[0]), first, std::next(first.begin(), move[1]),
+                     std::next(first.begin(), move[2]));
+        std_first.splice(std::next(std_first.begin(), move[0]), std_first,
+                         std::next(std_first.begin(), move[1]), std::next(std_first.begin(), move[2]));
+        compare_unrolled(first, std_first);
+    }
+    first.splice(first.begin(), first, std::prev(first.end()));
+    std_first.splice(std_first.begin(), std_first, std::prev(std_first.end()));
+    first.splice(std::next(first.begin(), 4), first, std::next(first.begin(), 4));
+    std_first.splice(std::next(std_first.begin(), 4), std_first, std::next(std_first.begin(), 4));
+    compare_unrolled(first, std_first);
+
+    // В пустой список
+    second.splice(second.begin(), first, std::next(first.begin(), 10), std::next(first.begin(), 25));
+    std_second.splice(std_second.begin(), std_first, std::next(std_first.begin(), 10),
+                      std::next(std_first.begin(), 25));
+    compare_unrolled(first, std_first);
+    compare_unrolled(second, std_second);
+}
+
+// Элементы с from по to лежат подряд, то есть в одном блоке
+template <class List>
+bool same_block(List &unrolled, int from, int to) {
+    auto first = std::next(unrolled.begin(), from);
+    auto last = std::next(unrolled.begin(), to);
+    return &*last - &*first == to - from;
+}
+
+TEST(s21_unrolled_list_case, compact_blocks) {
+    // unique сливает опустевшие наполовину блоки, а не оставляет по элементу в каждом
+    small_unrolled_list first{0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4};
+    ASSERT_FALSE(same_block(first, 0, 4));
+    ASSERT_EQ(first.unique(), 13);
+    compare_unrolled(first, {0, 1, 2, 3, 4});
+    ASSERT_TRUE(same_block(first, 0, 3));
+
+    // Стыки после переноса целого списка тоже сливаются
+    small_unrolled_list second{1, 2, 3};
+    small_unrolled_list middle{9};
+    second.splice(std::next(second.begin()), middle);
+    compare_unrolled(second, {1, 9, 2, 3});
+    ASSERT_TRUE(same_block(second, 0, 3));
+    small_unrolled_list tail{7, 8};
+    first.splice(first.end(), tail);
+    compare_unrolled(first, {0, 1, 2, 3, 4, 7, 8});
+    ASSERT_TRUE(same_block(first, 4, 6));
+}
+
+TEST(s21_unrolled_list_case, strings) {
+    s21::unrolled_list<std::string, 128> unrolled;
+    for (int i = 0; i < 100; ++i) unrolled.push_back(std::to_string(i));
+    unrolled.insert(std::next(unrolled.begin(), 50), *std::next(unrolled.begin(), 10));
+    ASSERT_EQ(*std::next(unrolled.begin(), 50), "10");
+    for (auto it = unrolled.begin(); it != unrolled.end();) {
+        it = it->size() == 1 ? unrolled.erase(it) : std::next(it);
+    }
+    ASSERT_EQ(unrolled.size(), 91);
+    ASSERT_EQ(unrolled.front(), "10");
+    unrolled.sort();
+    ASSERT_EQ(unrolled.back(), "99");
+    const s21::unrolled_list<std::string, 128> &view = unrolled;
+    size_t count = 0;
+    for (auto it = view.begin(); it != view.end(); ++it) ++count;
+    ASSERT_EQ(count, 91);
+}
@@ -1,9 +1,85 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <type_traits>
 #include <vector>
 
 #include "../classes/s21_vector.hpp"
 
+struct vector_counted_item {
+    static size_t created;
+    static size_t destroyed;
+    static size_t copies;
+    static size_t moves;
+
+    int value_;
+
+    vector_counted_item() : value_(0) { ++created; }
+    vector_counted_item(int value) : value_(value) { ++created; }  // NOLINT(runtime/explicit)
+    vector_counted_item(const vector_counted_item &other) : value_(other.value_) {
+        ++created;
+        ++copies;
+    }
+    vector_counted_item(vector_counted_item &&other) noexcept : value_(other.value_) {
+        ++created;
+        ++moves;
+    }
+    ~vector_counted_item() { ++destroyed; }
+    vector_counted_item &operator=(const vector_counted_item &other) {
+        value_ = other.value_;
+        ++copies;
+        return *this;
+    }
+    vector_counted_item &operator=(vector_counted_item &&other) noexcept {
+        value_ = other.value_;
+        ++moves;
+        return *this;
+    }
+
+    static void reset() { created = destroyed = copies = moves = 0; }
+};
+
+struct vector_pod_item {
+    int key_;
+    double value_;
+};
+
+struct vector_no_default_item {
+    explicit vector_no_default_item(int value) : value_(value) {}
+    int value_;
+};
+
+// Конструкторы бросают исключение, когда счетчик throw_after доходит до нуля; перемещение не
+// noexcept, поэтому при переносе вектор копирует элементы
+struct vector_throwing_item {
+    static int throw_after;
+    static size_t live;
+
+    int value_;
+
+    vector_throwing_item(int value) : value_(value) { create(); }  // NOLINT(runtime/explicit)
+    vector_throwing_item(const vector_throwing_item &other) : value_(other.value_) { create(); }
+    vector_throwing_item(vector_throwing_item &&other) : value_(other.value_) { create(); }
+    ~vector_throwing_item() { --live; }
+    vector_throwing_item &operator=(const vector_throwing_item &other) = default;
+
+    void create() {
+        if (throw_after >= 0 && throw_after-- == 0) throw std::runtime_error("construction failed");
+        ++live;
+    }
+};
+
+int vector_throwing_item::throw_after = -1;
+size_t vector_throwing_item::live = 0;
+
+size_t vector_counted_item::created = 0;
+size_t vector_counted_item::destroyed = 0;
+size_t vector_counted_item::copies = 0;
+size_t vector_counted_item::moves = 0;
+
 TEST(s21_vector_case, create_1) {
     s21::vector<float> s21_vector;
     std::vector<float> std_vector;
@@ -181,13 +257,513 @@ TEST(s21_vector_case, swap) {
 
 TEST(s21_vector_case, emplace) {
     s21::vector<int> vector{1, 2, 3, 4, 5};
-    std::vector<int> vector2{1, 8, 7, 6, 2, 3, 4, 5};
+    std::vector<int> vector2{1, 2, 3, 4, 5};
     auto pos = vector.begin();
     ++pos;
-    auto result = vector.emplace(pos, 8, 7, 6);
-    ASSERT_EQ(*result, 6);
+    auto result = vector.emplace(pos, 8);
+    auto result2 = vector2.emplace(vector2.begin() + 1, 8);
+    ASSERT_EQ(*result, *result2);
+
+    vector.emplace_back(11);
+    vector2.emplace_back(11);
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+}
+
+TEST(s21_vector_case, push_back_growth) {
+    s21::vector<int> vector;
+    size_t reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        size_t capacity = vector.capacity();
+        vector.push_back(i);
+        if (vector.capacity() != capacity) ++reallocations;
+    }
+    ASSERT_EQ(vector.size(), 1000);
+    ASSERT_EQ(vector.capacity(), 1024);
+    ASSERT_EQ(reallocations, 11);
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], i);
+}
+
+TEST(s21_vector_case, push_back_linear_transfers) {
+    const size_t n = 100000;
+    s21::vector<vector_counted_item> vector;
+    vector_counted_item item(7);
+    vector_counted_item::reset();
+    for (size_t i = 0; i < n; ++i) vector.push_back(item);
+    ASSERT_EQ(vector.size(), n);
+    ASSERT_LE(vector_counted_item::copies + vector_counted_item::moves, 3 * n);
+}
+
+TEST(s21_vector_case, push_back_self_element) {
+    s21::vector<int> vector{1, 2, 3, 4};
+    vector.push_back(vector[0]);
+    vector.push_back(vector[4]);
+    ASSERT_EQ(vector.size(), 6);
+    ASSERT_EQ(vector[4], 1);
+    ASSERT_EQ(vector[5], 1);
+}
+
+TEST(s21_vector_case, push_back_after_clear) {
+    s21::vector<int> vector{1, 2, 3};
+    vector.clear();
+    vector.push_back(5);
+    ASSERT_EQ(vector.size(), 1);
+    ASSERT_EQ(vector[0], 5);
+}
+
+TEST(s21_vector_case, reserve_without_construction) {
+    vector_counted_item::reset();
+    {
+        s21::vector<vector_counted_item> vector;
+        vector.reserve(1000000);
+        ASSERT_EQ(vector.capacity(), 1000000);
+        ASSERT_EQ(vector.size(), 0);
+        ASSERT_EQ(vector_counted_item::created, 0);
+        vector.push_back(1);
+        vector.push_back(2);
+    }
+    ASSERT_EQ(vector_counted_item::created, vector_counted_item::destroyed);
+}
+
+TEST(s21_vector_case, live_range_destruction) {
+    vector_counted_item::reset();
+    {
+        s21::vector<vector_counted_item> vector(3);
+        ASSERT_EQ(vector_counted_item::created, 3);
+        vector.reserve(10);
+        vector.pop_back();
+        vector.erase(vector.begin());
+        ASSERT_EQ(vector.size(), 1);
+        ASSERT_EQ(vector_counted_item::created - vector_counted_item::destroyed, 1);
+        vector.shrink_to_fit();
+        ASSERT_EQ(vector_counted_item::created - vector_counted_item::destroyed, 1);
+    }
+    ASSERT_EQ(vector_counted_item::created, vector_counted_item::destroyed);
+}
+
+TEST(s21_vector_case, transfer_exception_safety) {
+    // Копия, бросившая на середине переноса, оставляет вектор прежним и не теряет память
+    {
+        s21::vector<vector_throwing_item> vector{1, 2, 3, 4};
+        ASSERT_EQ(vector.capacity(), 4);
+        vector_throwing_item::throw_after = 2;
+        ASSERT_THROW(vector.reserve(10), std::runtime_error);
+        vector_throwing_item::throw_after = 2;
+        ASSERT_THROW(vector.insert(vector.begin() + 1, 2, vector[0]), std::runtime_error);
+        vector_throwing_item::throw_after = -1;
+        ASSERT_EQ(vector.size(), 4);
+        ASSERT_EQ(vector.capacity(), 4);
+        for (int i = 0; i < 4; ++i) ASSERT_EQ(vector[i].value_, i + 1);
+        ASSERT_EQ(vector_throwing_item::live, 4);
+    }
+    ASSERT_EQ(vector_throwing_item::live, 0);
+}
+
+TEST(s21_vector_case, insert_exception_safety) {
+    // Копия, бросившая при заполнении освобожденных слотов, возвращает хвост на место
+    {
+        // Емкости хватает, поэтому хвост сдвигается на месте: счетчик учитывает копию value
+        // и перемещения хвоста перед заполнением
+        s21::vector<vector_throwing_item> vector;
+        vector.reserve(16);
+        for (int i = 0; i < 7; ++i) vector.push_back(i);
+        vector_throwing_item value(42);
+        vector_throwing_item::throw_after = 1 + 5 + 2;
+        ASSERT_THROW(vector.insert(vector.begin() + 2, 5, value), std::runtime_error);
+        vector_throwing_item::throw_after = 1 + 5;
+        ASSERT_THROW(vector.insert(vector.begin() + 2, 1, value), std::runtime_error);
+        s21::vector<vector_throwing_item> source{7, 8, 9};
+        vector_throwing_item::throw_after = 6 + 2;
+        ASSERT_THROW(vector.insert(vector.begin() + 1, source.begin(), source.end()), std::runtime_error);
+        vector_throwing_item::throw_after = -1;
+        ASSERT_EQ(vector.size(), 7);
+        for (int i = 0; i < 7; ++i) ASSERT_EQ(vector[i].value_, i);
+        ASSERT_EQ(vector_throwing_item::live, 11);
+    }
+    ASSERT_EQ(vector_throwing_item::live, 0);
+}
+
+TEST(s21_vector_case, emplace_exception_safety) {
+    // Бросивший конструктор нового элемента или копия при переносе не оставляют утечек
+    {
+        s21::vector<vector_throwing_item> vector{1, 2, 3, 4};
+        ASSERT_EQ(vector.capacity(), vector.size());
+        vector_throwing_item::throw_after = 0;
+        ASSERT_THROW(vector.emplace_back(5), std::runtime_error);
+        vector_throwing_item::throw_after = 0;
+        ASSERT_THROW(vector.emplace(vector.begin() + 2, 5), std::runtime_error);
+        vector_throwing_item::throw_after = 3;
+        ASSERT_THROW(vector.emplace_back(5), std::runtime_error);
+        vector_throwing_item::throw_after = -1;
+        ASSERT_EQ(vector.size(), 4);
+        ASSERT_EQ(vector.capacity(), 4);
+        for (int i = 0; i < 4; ++i) ASSERT_EQ(vector[i].value_, i + 1);
+        ASSERT_EQ(vector_throwing_item::live, 4);
+        vector.emplace_back(5);
+        ASSERT_EQ(vector.back().value_, 5);
+    }
+    ASSERT_EQ(vector_throwing_item::live, 0);
+}
+
+TEST(s21_vector_case, no_default_constructor) {
+    s21::vector<vector_no_default_item> vector;
+    vector.reserve(2);
+    for (int i = 0; i < 5; ++i) vector.push_back(vector_no_default_item(i));
+    vector.insert(vector.begin() + 1, vector_no_default_item(10));
+    ASSERT_EQ(vector.size(), 6);
+    ASSERT_EQ(vector[1].value_, 10);
+    ASSERT_EQ(vector[5].value_, 4);
+}
+
+TEST(s21_vector_case, emplace_from_arguments) {
+    s21::vector<std::string> vector;
+    vector.emplace_back(3, 'a');
+    vector.emplace_back("bcd", 2);
+    auto pos = vector.emplace(vector.begin() + 1, 4, 'z');
+    ASSERT_EQ(*pos, "zzzz");
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[0], "aaa");
+    ASSERT_EQ(vector[2], "bc");
+}
+
+TEST(s21_vector_case, emplace_without_copies) {
+    s21::vector<vector_counted_item> vector;
+    vector.reserve(8);
+    vector_counted_item::reset();
+    vector.emplace_back(1);
+    vector.emplace_back(3);
+    vector.emplace(vector.begin() + 1, 2);
+    vector.push_back(vector_counted_item(4));
+    ASSERT_EQ(vector_counted_item::copies, 0);
+    for (int i = 0; i < 4; i++) ASSERT_EQ(vector[i].value_, i + 1);
+}
+
+TEST(s21_vector_case, emplace_self_element) {
+    s21::vector<std::string> vector{"a", "b", "c"};
+    vector.emplace(vector.begin(), vector[2]);
+    vector.reserve(10);
+    vector.emplace(vector.begin(), vector[3]);
+    ASSERT_EQ(vector.size(), 5);
+    ASSERT_EQ(vector[0], "c");
+    ASSERT_EQ(vector[1], "c");
+    ASSERT_EQ(vector[4], "c");
+}
+
+TEST(s21_vector_case, push_back_move_only) {
+    s21::vector<std::unique_ptr<int>> vector;
+    for (int i = 0; i < 10; ++i) vector.push_back(std::make_unique<int>(i));
+    vector.emplace(vector.begin(), new int(-1));
+    ASSERT_EQ(vector.size(), 11);
+    ASSERT_EQ(*vector[0], -1);
+    ASSERT_EQ(*vector[10], 9);
+}
+
+s21::vector<vector_counted_item> make_counted_vector(int n) {
+    s21::vector<vector_counted_item> vector;
+    for (int i = 0; i < n; ++i) vector.emplace_back(i);
+    return vector;
+}
+
+TEST(s21_vector_case, move_without_element_copies) {
+    s21::vector<vector_counted_item> vector = make_counted_vector(100);
+    vector_counted_item *data = vector.data();
+    vector_counted_item::reset();
+
+    s21::vector<vector_counted_item> vector2(std::move(vector));
+    ASSERT_EQ(vector2.data(), data);
+    ASSERT_EQ(vector2.size(), 100);
+    ASSERT_EQ(vector.data(), nullptr);
+    ASSERT_EQ(vector.size(), 0);
+
+    s21::vector<vector_counted_item> vector3{1, 2, 3};
+    vector_counted_item::reset();
+    vector3 = std::move(vector2);
+    ASSERT_EQ(vector3.data(), data);
+    ASSERT_EQ(vector3.size(), 100);
+    ASSERT_EQ(vector2.size(), 0);
+    ASSERT_EQ(vector2.capacity(), 0);
+
+    ASSERT_EQ(vector_counted_item::copies, 0);
+    ASSERT_EQ(vector_counted_item::moves, 0);
+    ASSERT_EQ(vector_counted_item::created, 0);
+    ASSERT_EQ(vector_counted_item::destroyed, 3);
+    for (int i = 0; i < 100; ++i) ASSERT_EQ(vector3[i].value_, i);
+}
 
-    vector.emplace_back(11, 22, 33);
-    std::vector<int> vector3{1, 1, 1, 8, 2, 3, 4, 5, 11, 22, 33};
-    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector3[i]);
+TEST(s21_vector_case, move_noexcept) {
+    ASSERT_TRUE(std::is_nothrow_move_constructible<s21::vector<std::string>>::value);
+    ASSERT_TRUE(std::is_nothrow_move_assignable<s21::vector<std::string>>::value);
+}
+
+TEST(s21_vector_case, trivially_copyable_paths) {
+    s21::vector<vector_pod_item> vector;
+    for (int i = 0; i < 100; ++i) vector.push_back({i, i * 0.5});
+    vector.insert(vector.begin() + 50, {-1, -1.0});
+    vector.erase(vector.begin() + 10);
+    vector.reserve(1000);
+    s21::vector<vector_pod_item> vector2;
+    vector2 = vector;
+    ASSERT_EQ(vector2.size(), 100);
+    ASSERT_EQ(vector2[9].key_, 9);
+    ASSERT_EQ(vector2[10].key_, 11);
+    ASSERT_EQ(vector2[49].key_, -1);
+    ASSERT_EQ(vector2[50].key_, 50);
+    ASSERT_EQ(vector2[99].value_, 49.5);
+}
+
+TEST(s21_vector_case, insert_range) {
+    s21::vector<int> vector{1, 2, 7, 8};
+    std::vector<int> vector2{1, 2, 7, 8};
+    std::vector<int> batch{3, 4, 5, 6};
+    auto pos = vector.insert(vector.begin() + 2, batch.begin(), batch.end());
+    auto pos2 = vector2.insert(vector2.begin() + 2, batch.begin(), batch.end());
+    ASSERT_EQ(*pos, *pos2);
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+
+    vector.reserve(100);
+    vector2.reserve(100);
+    vector.insert(vector.end(), batch.begin(), batch.end());
+    vector2.insert(vector2.end(), batch.begin(), batch.end());
+    vector.insert(vector.begin(), batch.begin(), batch.begin());
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+}
+
+TEST(s21_vector_case, insert_count) {
+    s21::vector<std::string> vector{"a", "b", "c"};
+    std::vector<std::string> vector2{"a", "b", "c"};
+    auto pos = vector.insert(vector.begin() + 1, 5, vector[2]);
+    auto pos2 = vector2.insert(vector2.begin() + 1, 5, vector2[2]);
+    ASSERT_EQ(*pos, *pos2);
+    vector.insert(vector.begin() + 3, 2, "x");
+    vector2.insert(vector2.begin() + 3, 2, "x");
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+}
+
+TEST(s21_vector_case, insert_range_single_reallocation) {
+    s21::vector<vector_counted_item> vector;
+    for (int i = 0; i < 10; ++i) vector.emplace_back(i);
+    std::vector<vector_counted_item> batch(100, vector_counted_item(-1));
+    vector_counted_item::reset();
+    vector.insert(vector.begin() + 5, batch.begin(), batch.end());
+    ASSERT_EQ(vector.size(), 110);
+    ASSERT_EQ(vector_counted_item::copies, 100);
+    ASSERT_EQ(vector_counted_item::moves, 10);
+    ASSERT_EQ(vector[4].value_, 4);
+    ASSERT_EQ(vector[5].value_, -1);
+    ASSERT_EQ(vector[105].value_, 5);
+}
+
+TEST(s21_vector_case, erase_range) {
+    s21::vector<std::string> vector{"0", "1", "2", "3", "4", "5"};
+    std::vector<std::string> vector2{"0", "1", "2", "3", "4", "5"};
+    auto pos = vector.erase(vector.begin() + 1, vector.begin() + 4);
+    auto pos2 = vector2.erase(vector2.begin() + 1, vector2.begin() + 4);
+    ASSERT_EQ(*pos, *pos2);
+    ASSERT_EQ(vector.size(), vector2.size());
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], vector2[i]);
+    vector.erase(vector.begin(), vector.end());
+    ASSERT_TRUE(vector.empty());
+}
+
+TEST(s21_vector_case, erase_if) {
+    s21::vector<int> vector{1, 2, 3, 4, 5, 6, 7, 8};
+    auto removed = vector.erase_if([](int value) { return value % 2 == 0; });
+    ASSERT_EQ(removed, 4);
+    ASSERT_EQ(vector.size(), 4);
+    for (long unsigned i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i], 2 * i + 1);
+
+    s21::vector<vector_counted_item> vector2 = make_counted_vector(10);
+    vector_counted_item::reset();
+    vector2.erase_if([](const vector_counted_item &item) { return item.value_ < 5; });
+    ASSERT_EQ(vector2.size(), 5);
+    ASSERT_EQ(vector2[0].value_, 5);
+    ASSERT_EQ(vector_counted_item::moves, 5);
+    ASSERT_EQ(vector_counted_item::destroyed, 5);
+}
+
+TEST(s21_vector_case, clear_keeps_capacity) {
+    s21::vector<vector_counted_item> vector = make_counted_vector(100);
+    vector_counted_item *data = vector.data();
+    size_t capacity = vector.capacity();
+    vector_counted_item::reset();
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), capacity);
+    ASSERT_EQ(vector_counted_item::destroyed, 100);
+    for (int i = 0; i < 100; ++i) vector.emplace_back(i);
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector[99].value_, 99);
+}
+
+template <typename T, size_t Alignment>
+bool vector_is_aligned(T *ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % Alignment == 0;
+}
+
+TEST(s21_vector_case, aligned_storage) {
+    s21::vector<float, s21::aligned_vector_storage<64>> vector;
+    for (int i = 0; i < 1000; ++i) {
+        vector.push_back(static_cast<float>(i));
+        ASSERT_TRUE((vector_is_aligned<float, 64>(vector.data())));
+    }
+    vector.shrink_to_fit();
+    ASSERT_TRUE((vector_is_aligned<float, 64>(vector.data())));
+    ASSERT_EQ(vector[999], 999.0f);
+
+    s21::vector<std::string, s21::aligned_vector_storage<128>> vector2{"a", "b", "c"};
+    vector2.insert(vector2.begin() + 1, 50, std::string("x"));
+    ASSERT_TRUE((vector_is_aligned<std::string, 128>(vector2.data())));
+    ASSERT_EQ(vector2.size(), 53);
+    ASSERT_EQ(vector2.back(), "c");
+    s21::vector<std::string, s21::aligned_vector_storage<128>> vector3(vector2);
+    ASSERT_TRUE((vector_is_aligned<std::string, 128>(vector3.data())));
+    ASSERT_EQ(vector3[1], "x");
+}
+
+TEST(s21_vector_case, huge_page_storage) {
+    using huge_vector = s21::vector<uint64_t, s21::huge_page_vector_storage<>>;
+    huge_vector vector(100);
+    ASSERT_TRUE((vector_is_aligned<uint64_t, 64>(vector.data())));
+    const size_t n = 3 * s21::huge_page_size / sizeof(uint64_t);
+    vector.reserve(n);
+    ASSERT_TRUE((vector_is_aligned<uint64_t, s21::huge_page_size>(vector.data())));
+    for (size_t i = 100; i < n; ++i) vector.push_back(i);
+    ASSERT_EQ(vector[n - 1], n - 1);
+    huge_vector moved(std::move(vector));
+    ASSERT_EQ(moved.size(), n);
+    moved.clear();
+    ASSERT_TRUE(moved.empty());
+}
+
+TEST(s21_vector_case, recycling_storage) {
+    using storage = s21::recycling_vector_storage<2>;
+    using recycled_vector = s21::vector<int, storage>;
+    storage::release_cache();
+    int *data = nullptr;
+    {
+        recycled_vector vector;
+        for (int i = 0; i < 1000; ++i) vector.push_back(i);
+        data = vector.data();
+    }
+    ASSERT_GT(storage::cached(), 0u);
+    {
+        recycled_vector vector;
+        vector.reserve(1000);
+        ASSERT_EQ(vector.data(), data);
+        vector.reserve(900);
+        for (int i = 0; i < 1000; ++i) vector.push_back(-i);
+        ASSERT_EQ(vector[999], -999);
+    }
+    {
+        recycled_vector vector;
+        vector.reserve(1000);
+        std::thread other([data] {
+            // Кэш у каждого потока свой
+            recycled_vector vector2;
+            vector2.reserve(1000);
+            ASSERT_NE(vector2.data(), data);
+        });
+        other.join();
+    }
+    storage::release_cache();
+    ASSERT_EQ(storage::cached(), 0u);
+
+    s21::vector<std::string, storage> strings{"a", "b"};
+    strings.insert(strings.begin() + 1, 100, std::string("x"));
+    ASSERT_EQ(strings.size(), 102);
+    ASSERT_EQ(strings.back(), "b");
+}
+
+TEST(s21_vector_case, mremap_growth) {
+    // Порог в одну страницу, чтобы проверить переотображение на небольших векторах
+    using mapped_vector = s21::vector<int, s21::vector_storage<0, 0, s21::page_size>>;
+    mapped_vector vector;
+    for (int i = 0; i < 100000; ++i) vector.push_back(i);
+    ASSERT_EQ(vector.size(), 100000);
+    for (int i = 0; i < 100000; ++i) ASSERT_EQ(vector[i], i);
+    vector.push_back(vector[5]);
+    ASSERT_EQ(vector.back(), 5);
+    vector.insert(vector.begin() + 10, 200000, -1);
+    ASSERT_EQ(vector[9], 9);
+    ASSERT_EQ(vector[10], -1);
+    ASSERT_EQ(vector[200010], 10);
+    vector.reserve(1000000);
+    ASSERT_EQ(vector.capacity(), 1000000);
+    ASSERT_EQ(vector.back(), 5);
+    vector.shrink_to_fit();
+    ASSERT_EQ(vector.capacity(), vector.size());
+    ASSERT_EQ(vector[299999], 99999);
+    mapped_vector copy(vector);
+    ASSERT_EQ(copy[299999], 99999);
+    vector.erase(vector.begin() + 10, vector.begin() + 200010);
+    vector.shrink_to_fit();
+    ASSERT_EQ(vector.size(), 100001);
+    ASSERT_EQ(vector[10], 10);
+
+    s21::vector<std::string, s21::vector_storage<0, 0, s21::page_size>> strings;
+    for (int i = 0; i < 1000; ++i) strings.push_back(std::to_string(i));
+    ASSERT_EQ(strings[999], "999");
+}
+
+TEST(s21_vector_case, growth_policies) {
+    s21::vector<int> doubling;
+    s21::vector<int, s21::default_vector_storage, s21::half_growth> half;
+    s21::vector<int, s21::default_vector_storage, s21::exact_growth> exact;
+    s21::vector<int, s21::default_vector_storage, s21::page_growth> paged;
+    for (int i = 0; i < 5; ++i) {
+        doubling.push_back(i);
+        half.push_back(i);
+        exact.push_back(i);
+        paged.push_back(i);
+    }
+    ASSERT_EQ(doubling.capacity(), 8);
+    ASSERT_EQ(half.capacity(), 6);
+    ASSERT_EQ(exact.capacity(), 5);
+    ASSERT_EQ(paged.capacity(), s21::page_size / sizeof(int));
+    exact.insert(exact.end(), 3, 7);
+    ASSERT_EQ(exact.capacity(), 8);
+    for (int i = 0; i < 5; ++i) ASSERT_EQ(half[i], i);
+
+    // Элементы больше страницы не округляются
+    struct big {
+        uint64_t words[513];  // 4104 байт
+    };
+    s21::vector<big, s21::default_vector_storage, s21::page_growth> bigs;
+    bigs.push_back(big());
+    bigs.push_back(big());
+    ASSERT_EQ(bigs.capacity(), 2);
+}
+
+TEST(s21_vector_case, shrinking_growth) {
+    s21::vector<std::string, s21::default_vector_storage, s21::shrinking_growth<s21::doubling_growth>> vector;
+    for (int i = 0; i < 64; ++i) vector.push_back(std::to_string(i));
+    ASSERT_EQ(vector.capacity(), 64);
+    while (vector.size() > 17) vector.pop_back();
+    ASSERT_EQ(vector.capacity(), 64);
+    vector.pop_back();
+    ASSERT_EQ(vector.size(), 16);
+    ASSERT_EQ(vector.capacity(), 32);
+    // Гистерезис: добавление и удаление на границе не меняют емкость
+    for (int i = 0; i < 10; ++i) {
+        vector.push_back("x");
+        vector.pop_back();
+    }
+    ASSERT_EQ(vector.capacity(), 32);
+    ASSERT_EQ(vector[15], "15");
+
+    vector.erase(vector.begin(), vector.begin() + 12);
+    ASSERT_EQ(vector.size(), 4);
+    ASSERT_EQ(vector.capacity(), 8);
+    ASSERT_EQ(vector.front(), "12");
+    ASSERT_EQ(vector.erase_if([](const std::string &s) { return s != "15"; }), 3);
+    ASSERT_EQ(vector.capacity(), 2);
+    ASSERT_EQ(vector.front(), "15");
+    vector.clear();
+    ASSERT_EQ(vector.capacity(), 2);
+    vector.push_back("a");
+    vector.pop_back();
+    ASSERT_EQ(vector.capacity(), 0);
 }